@@ -56,6 +56,7 @@ public class ImGui : ModuleRules
 		PublicIncludePaths.AddRange(
 			new string[] {
 				Path.Combine(ModuleDirectory, "../ThirdParty/ImGuiLibrary/Include"),
+				Path.Combine(ModuleDirectory, "../ThirdParty/ImPlotLibrary/Public"),
 				// ... add public include paths required here ...
 			}
 			);
@@ -65,6 +66,7 @@ public class ImGui : ModuleRules
 			new string[] {
 				"ImGui/Private",
 				"ThirdParty/ImGuiLibrary/Private",
+				"ThirdParty/ImPlotLibrary/Private",
 				// ... add other private include paths required here ...
 			}
 			);
@@ -86,9 +88,15 @@ public class ImGui : ModuleRules
 				"CoreUObject",
 				"EnhancedInput",
 				"Engine",
+				"ImGuiShaders",
 				"InputCore",
+				"Networking",
+				"RenderCore",
+				"RHI",
 				"Slate",
-				"SlateCore"
+				"SlateCore",
+				"Sockets",
+				"UMG"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -117,8 +125,13 @@ public class ImGui : ModuleRules
 
 #if !UE_4_19_OR_LATER
 		List<string> PrivateDefinitions = Definitions;
+		List<string> PublicDefinitions = Definitions;
 #endif
 
 		PrivateDefinitions.Add(string.Format("RUNTIME_LOADER_ENABLED={0}", bEnableRuntimeLoader ? 1 : 0));
+
+		// ImPlot is built as part of this module (see ImGuiImplementation.cpp), so its symbols are exported and imported
+		// in the same way as the module API.
+		PublicDefinitions.Add("IMPLOT_API=IMGUI_API");
 	}
 }
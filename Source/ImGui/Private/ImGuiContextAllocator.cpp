@@ -0,0 +1,251 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ImGuiContextAllocator.h"
+
+#include <HAL/LowLevelMemTracker.h>
+
+#include <imgui.h>
+
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+#define IMGUI_ALLOCATOR_LLM_SCOPE() FLLMScope LLMScope(LLMTagName, false, ELLMTagSet::None, ELLMTracker::Default)
+#else
+#define IMGUI_ALLOCATOR_LLM_SCOPE()
+#endif
+
+namespace
+{
+	// Header preceding every block. Its size keeps user memory 16-byte aligned.
+	struct alignas(16) FBlockHeader
+	{
+		FImGuiContextAllocator* Owner;
+		uint32 SizeClass;
+		uint32 Size;
+	};
+
+	// Size of the smallest block class (including header). Each next class doubles the size.
+	constexpr SIZE_T MinBlockSizeLog2 = 5;
+	constexpr SIZE_T MinBlockSize = SIZE_T(1) << MinBlockSizeLog2;
+
+	// Size of pages from which we carve blocks.
+	constexpr SIZE_T PageSize = 64 * 1024;
+
+	// Marker for blocks allocated directly from FMemory.
+	constexpr uint32 LargeSizeClass = MAX_uint32;
+
+	FORCEINLINE SIZE_T GetBlockSize(uint32 SizeClass)
+	{
+		return MinBlockSize << SizeClass;
+	}
+
+	FORCEINLINE uint32 GetSizeClass(SIZE_T BlockSize, int32 NumSizeClasses)
+	{
+		const uint32 SizeClass = (BlockSize <= MinBlockSize) ? 0
+			: static_cast<uint32>(FMath::CeilLogTwo64(static_cast<uint64>(BlockSize)) - MinBlockSizeLog2);
+		return (SizeClass < static_cast<uint32>(NumSizeClasses)) ? SizeClass : LargeSizeClass;
+	}
+
+	FORCEINLINE FBlockHeader* GetHeader(void* Ptr)
+	{
+		return static_cast<FBlockHeader*>(Ptr) - 1;
+	}
+}
+
+FImGuiContextAllocator* FImGuiContextAllocator::Create(const FString& ContextName)
+{
+	return new FImGuiContextAllocator(ContextName);
+}
+
+FImGuiContextAllocator::FImGuiContextAllocator(const FString& ContextName)
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	: LLMTagName(*FString::Printf(TEXT("ImGui/%s"), *ContextName))
+#endif
+{
+}
+
+FImGuiContextAllocator::~FImGuiContextAllocator()
+{
+	for (void* Page : Pages)
+	{
+		FMemory::Free(Page);
+	}
+}
+
+void FImGuiContextAllocator::InstallDefault()
+{
+	ImGui::SetAllocatorFunctions(&FImGuiContextAllocator::AllocFunc, &FImGuiContextAllocator::FreeFunc, nullptr);
+}
+
+void FImGuiContextAllocator::Install()
+{
+	ImGui::SetAllocatorFunctions(&FImGuiContextAllocator::AllocFunc, &FImGuiContextAllocator::FreeFunc, this);
+}
+
+void FImGuiContextAllocator::Release()
+{
+	checkf(!bReleased, TEXT("ImGui context allocator released more than once."));
+
+	// Make sure that ImGui will not use this allocator for new allocations.
+	ImGuiMemAllocFunc InstalledAllocFunc;
+	ImGuiMemFreeFunc InstalledFreeFunc;
+	void* InstalledUserData;
+	ImGui::GetAllocatorFunctions(&InstalledAllocFunc, &InstalledFreeFunc, &InstalledUserData);
+	if (InstalledUserData == this)
+	{
+		InstallDefault();
+	}
+
+	// Memory allocated in this context can outlive it (e.g. when font atlas is rebuilt while context is current), so we
+	// can only delete this allocator once everything is returned.
+	bReleased = true;
+	if (LiveAllocations == 0)
+	{
+		delete this;
+	}
+}
+
+void FImGuiContextAllocator::NextFrame()
+{
+	AllocationsLastFrame = AllocationsThisFrame;
+	LargeAllocationsLastFrame = LargeAllocationsThisFrame;
+	AllocationsThisFrame = 0;
+	LargeAllocationsThisFrame = 0;
+}
+
+void* FImGuiContextAllocator::AllocFunc(size_t Size, void* UserData)
+{
+	if (FImGuiContextAllocator* Allocator = static_cast<FImGuiContextAllocator*>(UserData))
+	{
+		return Allocator->Allocate(Size);
+	}
+
+	// Allocation without owner.
+	FBlockHeader* Header = static_cast<FBlockHeader*>(FMemory::Malloc(Size + sizeof(FBlockHeader), alignof(FBlockHeader)));
+	Header->Owner = nullptr;
+	Header->SizeClass = LargeSizeClass;
+	Header->Size = static_cast<uint32>(Size);
+	return Header + 1;
+}
+
+void FImGuiContextAllocator::FreeFunc(void* Ptr, void* UserData)
+{
+	if (Ptr)
+	{
+		// Ignore user data and release to the owner of the block.
+		FBlockHeader* Header = GetHeader(Ptr);
+		if (Header->Owner)
+		{
+			Header->Owner->Free(Header, Header->SizeClass, Header->Size);
+		}
+		else
+		{
+			FMemory::Free(Header);
+		}
+	}
+}
+
+void* FImGuiContextAllocator::Allocate(SIZE_T Size)
+{
+	const SIZE_T BlockSize = Size + sizeof(FBlockHeader);
+	const uint32 SizeClass = GetSizeClass(BlockSize, NumSizeClasses);
+
+	FBlockHeader* Header;
+	if (SizeClass != LargeSizeClass)
+	{
+		if (UNLIKELY(!FreeLists[SizeClass]))
+		{
+			AllocatePage(SizeClass);
+		}
+
+		FFreeBlock* Block = FreeLists[SizeClass];
+		FreeLists[SizeClass] = Block->Next;
+		Header = reinterpret_cast<FBlockHeader*>(Block);
+	}
+	else
+	{
+		IMGUI_ALLOCATOR_LLM_SCOPE();
+		Header = static_cast<FBlockHeader*>(FMemory::Malloc(BlockSize, alignof(FBlockHeader)));
+		ReservedBytes += BlockSize;
+		LargeAllocationsThisFrame++;
+	}
+
+	Header->Owner = this;
+	Header->SizeClass = SizeClass;
+	Header->Size = static_cast<uint32>(Size);
+
+	LiveBytes += Size;
+	PeakBytes = FMath::Max(PeakBytes, LiveBytes);
+	LiveAllocations++;
+	AllocationsThisFrame++;
+
+	return Header + 1;
+}
+
+void FImGuiContextAllocator::Free(void* Block, uint32 SizeClass, SIZE_T Size)
+{
+	if (SizeClass != LargeSizeClass)
+	{
+		FFreeBlock* FreeBlock = static_cast<FFreeBlock*>(Block);
+		FreeBlock->Next = FreeLists[SizeClass];
+		FreeLists[SizeClass] = FreeBlock;
+	}
+	else
+	{
+		FMemory::Free(Block);
+		ReservedBytes -= Size + sizeof(FBlockHeader);
+	}
+
+	LiveBytes -= Size;
+	LiveAllocations--;
+
+	if (bReleased && LiveAllocations == 0)
+	{
+		delete this;
+	}
+}
+
+void FImGuiContextAllocator::AllocatePage(uint32 SizeClass)
+{
+	uint8* Page;
+	{
+		IMGUI_ALLOCATOR_LLM_SCOPE();
+		Page = static_cast<uint8*>(FMemory::Malloc(PageSize, alignof(FBlockHeader)));
+	}
+
+	Pages.Add(Page);
+	ReservedBytes += PageSize;
+
+	// Split the whole page into blocks and push them to the free list, keeping ascending order of addresses.
+	const SIZE_T BlockSize = GetBlockSize(SizeClass);
+	const SIZE_T NumBlocks = PageSize / BlockSize;
+	for (SIZE_T Index = NumBlocks; Index-- > 0;)
+	{
+		FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Page + Index * BlockSize);
+		Block->Next = FreeLists[SizeClass];
+		FreeLists[SizeClass] = Block;
+	}
+}
+
+#undef IMGUI_ALLOCATOR_LLM_SCOPE
@@ -0,0 +1,118 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+
+// Size-classed pool allocator that backs ImGui allocations made while a context is current. Small blocks are carved
+// from pages that are kept for the life-time of the allocator, so allocations repeated in every frame are recycled
+// instead of hitting the global allocator. Bigger blocks are forwarded to FMemory.
+//
+// ImGui allocator functions are global, so we install them together with the current context (see SetAsCurrent in
+// context proxy) and every block stores its owner in a small header. That allows to free memory correctly, even if it
+// is released while a different context is current (e.g. shared font atlas).
+//
+// Like the rest of ImGui, the allocator is not thread-safe and should only be used from the game thread.
+class FImGuiContextAllocator
+{
+public:
+
+	// Create a new allocator. Use Release instead of deleting it directly.
+	// @param ContextName - Name of the owning context, used to tag memory in LLM
+	static FImGuiContextAllocator* Create(const FString& ContextName);
+
+	// Install allocator functions in ImGui without owner. Memory allocated that way goes directly to FMemory, but it can
+	// be safely released while any other allocator is active. Should be called before ImGui allocates any memory.
+	static void InstallDefault();
+
+	// Install allocator functions in ImGui with this allocator as an owner of new allocations.
+	void Install();
+
+	// Release this allocator. If it is currently installed in ImGui, default allocator functions will be restored. Pages
+	// are freed once all allocations made with this allocator are returned.
+	void Release();
+
+	// Advance per-frame statistics. Should be called once at the beginning of every ImGui frame.
+	void NextFrame();
+
+	// Get the number of bytes currently requested by ImGui from this allocator.
+	SIZE_T GetLiveBytes() const { return LiveBytes; }
+
+	// Get the highest number of bytes ever requested by ImGui from this allocator at the same time.
+	SIZE_T GetPeakBytes() const { return PeakBytes; }
+
+	// Get the number of bytes reserved by this allocator from FMemory (pages and large blocks).
+	SIZE_T GetReservedBytes() const { return ReservedBytes; }
+
+	// Get the number of allocations made in the last complete frame.
+	int32 GetAllocationsPerFrame() const { return AllocationsLastFrame; }
+
+	// Get the number of allocations made in the last complete frame that had to be forwarded to FMemory.
+	int32 GetLargeAllocationsPerFrame() const { return LargeAllocationsLastFrame; }
+
+private:
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	static constexpr int32 NumSizeClasses = 8;
+
+	FImGuiContextAllocator(const FString& ContextName);
+	~FImGuiContextAllocator();
+
+	FImGuiContextAllocator(const FImGuiContextAllocator&) = delete;
+	FImGuiContextAllocator& operator=(const FImGuiContextAllocator&) = delete;
+
+	static void* AllocFunc(size_t Size, void* UserData);
+	static void FreeFunc(void* Ptr, void* UserData);
+
+	void* Allocate(SIZE_T Size);
+	void Free(void* Block, uint32 SizeClass, SIZE_T Size);
+
+	void AllocatePage(uint32 SizeClass);
+
+	FFreeBlock* FreeLists[NumSizeClasses] = {};
+	TArray<void*> Pages;
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	FName LLMTagName;
+#endif
+
+	SIZE_T LiveBytes = 0;
+	SIZE_T PeakBytes = 0;
+	SIZE_T ReservedBytes = 0;
+
+	int32 LiveAllocations = 0;
+
+	int32 AllocationsThisFrame = 0;
+	int32 AllocationsLastFrame = 0;
+	int32 LargeAllocationsThisFrame = 0;
+	int32 LargeAllocationsLastFrame = 0;
+
+	bool bReleased = false;
+};
@@ -24,6 +24,7 @@
 
 #include "ImGuiContextManager.h"
 
+#include "ImGuiContextAllocator.h"
 #include "ImGuiDelegatesContainer.h"
 #include "ImGuiImplementation.h"
 #include "ImGuiModuleSettings.h"
@@ -31,6 +32,12 @@
 #include "Utilities/WorldContext.h"
 #include "Utilities/WorldContextIndex.h"
 
+#include <Misc/DateTime.h>
+
+#if WITH_EDITOR
+#include <Editor.h>
+#endif
+
 #include <imgui.h>
 
 
@@ -82,30 +89,62 @@ namespace
 
 FImGuiContextManager::FImGuiContextManager(FImGuiModuleSettings& InSettings)
 	: Settings(InSettings)
+	, StartCaptureCommand(TEXT("ImGui.Capture.Start"),
+		TEXT("Start capturing ImGui draw data of the current world context. Optional argument: capture file path."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateRaw(this, &FImGuiContextManager::StartCaptureImpl))
+	, StopCaptureCommand(TEXT("ImGui.Capture.Stop"),
+		TEXT("Stop capturing ImGui draw data of the current world context."),
+		FConsoleCommandWithWorldDelegate::CreateRaw(this, &FImGuiContextManager::StopCaptureImpl))
+	, StartReplayCommand(TEXT("ImGui.Replay.Start"),
+		TEXT("Replay captured ImGui draw data in the current world context. Argument: capture file path."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateRaw(this, &FImGuiContextManager::StartReplayImpl))
+	, StopReplayCommand(TEXT("ImGui.Replay.Stop"),
+		TEXT("Stop replaying ImGui draw data in the current world context."),
+		FConsoleCommandWithWorldDelegate::CreateRaw(this, &FImGuiContextManager::StopReplayImpl))
 {
+	// Route all ImGui allocations through our allocator functions before anything is allocated, so memory can be
+	// safely released while any of the context allocators is installed.
+	FImGuiContextAllocator::InstallDefault();
+
 	Settings.OnDPIScaleChangedDelegate.AddRaw(this, &FImGuiContextManager::SetDPIScale);
+	Settings.OnUpdateRateChangedDelegate.AddRaw(this, &FImGuiContextManager::SetUpdateRate);
 
 	SetDPIScale(Settings.GetDPIScaleInfo());
+	SetUpdateRate(Settings.GetUpdateRate());
 	BuildFontAtlas();
 
 	FWorldDelegates::OnWorldTickStart.AddRaw(this, &FImGuiContextManager::OnWorldTickStart);
 #if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
 	FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FImGuiContextManager::OnWorldPostActorTick);
 #endif
+
+	FWorldDelegates::OnWorldCleanup.AddRaw(this, &FImGuiContextManager::OnWorldCleanup);
+	FWorldDelegates::OnPreWorldFinishDestroy.AddRaw(this, &FImGuiContextManager::RemoveCachedWorldContext);
+#if WITH_EDITOR
+	FEditorDelegates::EndPIE.AddRaw(this, &FImGuiContextManager::OnEndPIE);
+#endif
 }
 
 FImGuiContextManager::~FImGuiContextManager()
 {
 	// Early dealloc of contexts for clean shutdown order
+	ResetCachedWorldContexts();
 	Contexts.Reset();
 	
 	Settings.OnDPIScaleChangedDelegate.RemoveAll(this);
+	Settings.OnUpdateRateChangedDelegate.RemoveAll(this);
 
 	// Order matters because contexts can be created during World Tick Start events.
 	FWorldDelegates::OnWorldTickStart.RemoveAll(this);
 #if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
 	FWorldDelegates::OnWorldPostActorTick.RemoveAll(this);
 #endif
+
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+	FWorldDelegates::OnPreWorldFinishDestroy.RemoveAll(this);
+#if WITH_EDITOR
+	FEditorDelegates::EndPIE.RemoveAll(this);
+#endif
 }
 
 void FImGuiContextManager::Tick(float DeltaSeconds)
@@ -178,7 +217,7 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetEditorContextData()
 	if (UNLIKELY(!Data))
 	{
 		Data = &Contexts.Emplace(Utilities::EDITOR_CONTEXT_INDEX, FContextData{ GetEditorContextName(), Utilities::EDITOR_CONTEXT_INDEX, FontAtlas, DPIScale, -1 });
-		OnContextProxyCreated.Broadcast(Utilities::EDITOR_CONTEXT_INDEX, *Data->ContextProxy);
+		OnContextProxyInitialized(Utilities::EDITOR_CONTEXT_INDEX, *Data->ContextProxy);
 	}
 
 	return *Data;
@@ -193,7 +232,7 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetStandaloneWorldCont
 	if (UNLIKELY(!Data))
 	{
 		Data = &Contexts.Emplace(Utilities::STANDALONE_GAME_CONTEXT_INDEX, FContextData{ GetWorldContextName(), Utilities::STANDALONE_GAME_CONTEXT_INDEX, FontAtlas, DPIScale });
-		OnContextProxyCreated.Broadcast(Utilities::STANDALONE_GAME_CONTEXT_INDEX, *Data->ContextProxy);
+		OnContextProxyInitialized(Utilities::STANDALONE_GAME_CONTEXT_INDEX, *Data->ContextProxy);
 	}
 
 	return *Data;
@@ -235,7 +274,7 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 	if (UNLIKELY(!Data))
 	{
 		Data = &Contexts.Emplace(Index, FContextData{ GetWorldContextName(World), Index, FontAtlas, DPIScale, WorldContext->PIEInstance });
-		OnContextProxyCreated.Broadcast(Index, *Data->ContextProxy);
+		OnContextProxyInitialized(Index, *Data->ContextProxy);
 	}
 	else
 	{
@@ -246,7 +285,7 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 	if (UNLIKELY(!Data))
 	{
 		Data = &Contexts.Emplace(Index, FContextData{ GetWorldContextName(World), Index, FontAtlas, DPIScale });
-		OnContextProxyCreated.Broadcast(Index, *Data->ContextProxy);
+		OnContextProxyInitialized(Index, *Data->ContextProxy);
 	}
 #endif
 
@@ -257,6 +296,49 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 	return *Data;
 }
 
+const FImGuiContextManager::FCachedWorldContext& FImGuiContextManager::FindOrAddCachedWorldContext(const UWorld& World)
+{
+	FCachedWorldContext* CachedContext = CachedWorldContexts.Find(&World);
+	if (UNLIKELY(!CachedContext))
+	{
+		FCachedWorldContext NewContext;
+		NewContext.ContextProxy = GetWorldContextData(World, &NewContext.ContextIndex).ContextProxy.Get();
+		CachedContext = &CachedWorldContexts.Add(&World, NewContext);
+	}
+
+	LastCachedWorld = &World;
+	LastCachedWorldContext = *CachedContext;
+	return LastCachedWorldContext;
+}
+
+void FImGuiContextManager::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	RemoveCachedWorldContext(World);
+}
+
+#if WITH_EDITOR
+void FImGuiContextManager::OnEndPIE(const bool bIsSimulating)
+{
+	// PIE instances can be mapped to different contexts in the next session.
+	ResetCachedWorldContexts();
+}
+#endif
+
+void FImGuiContextManager::RemoveCachedWorldContext(UWorld* World)
+{
+	CachedWorldContexts.Remove(World);
+	if (LastCachedWorld == World)
+	{
+		LastCachedWorld = nullptr;
+	}
+}
+
+void FImGuiContextManager::ResetCachedWorldContexts()
+{
+	CachedWorldContexts.Reset();
+	LastCachedWorld = nullptr;
+}
+
 void FImGuiContextManager::SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo)
 {
 	const float Scale = ScaleInfo.GetImGuiScale();
@@ -281,6 +363,60 @@ void FImGuiContextManager::SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo)
 	}
 }
 
+void FImGuiContextManager::SetUpdateRate(float Rate)
+{
+	UpdateRate = Rate;
+
+	for (auto& Pair : Contexts)
+	{
+		if (Pair.Value.ContextProxy)
+		{
+			Pair.Value.ContextProxy->SetTargetUpdateRate(UpdateRate);
+		}
+	}
+}
+
+void FImGuiContextManager::StartCaptureImpl(const TArray<FString>& Args, UWorld* World)
+{
+	if (World)
+	{
+		FImGuiContextProxy& ContextProxy = GetWorldContextProxy(*World);
+		const FString Filename = (Args.Num() > 0) ? Args[0]
+			: FString::Printf(TEXT("%s-%s.imguicapture"), *ContextProxy.GetName(), *FDateTime::Now().ToString());
+		ContextProxy.StartCapture(Filename);
+	}
+}
+
+void FImGuiContextManager::StopCaptureImpl(UWorld* World)
+{
+	if (World)
+	{
+		GetWorldContextProxy(*World).StopCapture();
+	}
+}
+
+void FImGuiContextManager::StartReplayImpl(const TArray<FString>& Args, UWorld* World)
+{
+	if (World && Args.Num() > 0)
+	{
+		GetWorldContextProxy(*World).StartReplay(Args[0]);
+	}
+}
+
+void FImGuiContextManager::StopReplayImpl(UWorld* World)
+{
+	if (World)
+	{
+		GetWorldContextProxy(*World).StopReplay();
+	}
+}
+
+void FImGuiContextManager::OnContextProxyInitialized(int32 ContextIndex, FImGuiContextProxy& ContextProxy)
+{
+	ContextProxy.SetTargetUpdateRate(UpdateRate);
+	OnContextProxyCreated.Broadcast(ContextIndex, ContextProxy);
+}
+
 void FImGuiContextManager::BuildFontAtlas(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs)
 {
 	if (!FontAtlas.IsBuilt())
@@ -27,6 +27,8 @@
 #include "ImGuiContextProxy.h"
 #include "VersionCompatibility.h"
 
+#include <HAL/IConsoleManager.h>
+
 
 class FImGuiModuleSettings;
 struct FImGuiDPIScaleInfo;
@@ -68,10 +70,15 @@ public:
 #endif
 
 	// Get or create ImGui context proxy for given world.
-	FORCEINLINE FImGuiContextProxy& GetWorldContextProxy(const UWorld& World) { return *GetWorldContextData(World).ContextProxy; }
+	FORCEINLINE FImGuiContextProxy& GetWorldContextProxy(const UWorld& World) { return *GetCachedWorldContext(World).ContextProxy; }
 
 	// Get or create ImGui context proxy for given world. Additionally get context index for that proxy.
-	FORCEINLINE FImGuiContextProxy& GetWorldContextProxy(const UWorld& World, int32& OutContextIndex) { return *GetWorldContextData(World, &OutContextIndex).ContextProxy; }
+	FORCEINLINE FImGuiContextProxy& GetWorldContextProxy(const UWorld& World, int32& OutContextIndex)
+	{
+		const FCachedWorldContext& CachedContext = GetCachedWorldContext(World);
+		OutContextIndex = CachedContext.ContextIndex;
+		return *CachedContext.ContextProxy;
+	}
 
 	// Get context proxy by index, or null if context with that index doesn't exist.
 	FORCEINLINE FImGuiContextProxy* GetContextProxy(int32 ContextIndex)
@@ -106,6 +113,29 @@ private:
 		TUniquePtr<FImGuiContextProxy> ContextProxy;
 	};
 
+	// Context resolved for a world. Proxies are never released, so cached pointers stay valid.
+	struct FCachedWorldContext
+	{
+		FImGuiContextProxy* ContextProxy = nullptr;
+		int32 ContextIndex = Utilities::INVALID_CONTEXT_INDEX;
+	};
+
+	// Get context for given world, resolving and caching it when the world is seen for the first time. Worlds mostly
+	// tick one after another, so checking the last world first makes the common case a pointer comparison.
+	FORCEINLINE const FCachedWorldContext& GetCachedWorldContext(const UWorld& World)
+	{
+		return (&World == LastCachedWorld) ? LastCachedWorldContext : FindOrAddCachedWorldContext(World);
+	}
+
+	const FCachedWorldContext& FindOrAddCachedWorldContext(const UWorld& World);
+
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+#if WITH_EDITOR
+	void OnEndPIE(const bool bIsSimulating);
+#endif
+	void RemoveCachedWorldContext(UWorld* World);
+	void ResetCachedWorldContexts();
+
 #if ENGINE_COMPATIBILITY_LEGACY_WORLD_ACTOR_TICK
 	void OnWorldTickStart(ELevelTick TickType, float DeltaSeconds);
 #endif
@@ -125,16 +155,36 @@ private:
 
 	FContextData& GetWorldContextData(const UWorld& World, int32* OutContextIndex = nullptr);
 
+	// Apply settings to a newly created context proxy and broadcast its creation.
+	void OnContextProxyInitialized(int32 ContextIndex, FImGuiContextProxy& ContextProxy);
+
 	void SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo);
+	void SetUpdateRate(float Rate);
+
+	void StartCaptureImpl(const TArray<FString>& Args, UWorld* World);
+	void StopCaptureImpl(UWorld* World);
+	void StartReplayImpl(const TArray<FString>& Args, UWorld* World);
+	void StopReplayImpl(UWorld* World);
 	void BuildFontAtlas(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs = {});
 
 	TMap<int32, FContextData> Contexts;
 
+	// Cache of resolved world contexts, invalidated when worlds are cleaned up or PIE sessions end.
+	TMap<const UWorld*, FCachedWorldContext> CachedWorldContexts;
+	const UWorld* LastCachedWorld = nullptr;
+	FCachedWorldContext LastCachedWorldContext;
+
 	ImFontAtlas FontAtlas;
 	TArray<TUniquePtr<ImFontAtlas>> FontResourcesToRelease;
 
 	FImGuiModuleSettings& Settings;
 
 	float DPIScale = -1.f;
+	float UpdateRate = 0.f;
 	int32 FontResourcesReleaseCountdown = 0;
+
+	FAutoConsoleCommandWithWorldAndArgs StartCaptureCommand;
+	FAutoConsoleCommandWithWorld StopCaptureCommand;
+	FAutoConsoleCommandWithWorldAndArgs StartReplayCommand;
+	FAutoConsoleCommandWithWorld StopReplayCommand;
 };
@@ -62,37 +62,11 @@ namespace
 		return FPaths::Combine(SaveDirectory, Name + TEXT(".ini"));
 	}
 
-	struct FGuardCurrentContext
+	FString GetCaptureFile(const FString& Filename)
 	{
-		FGuardCurrentContext()
-			: OldContext(ImGui::GetCurrentContext())
-		{
-		}
-
-		~FGuardCurrentContext()
-		{
-			if (bRestore)
-			{
-				ImGui::SetCurrentContext(OldContext);
-			}
-		}
-
-		FGuardCurrentContext(FGuardCurrentContext&& Other)
-			: OldContext(MoveTemp(Other.OldContext))
-		{
-			Other.bRestore = false;
-		}
-
-		FGuardCurrentContext& operator=(FGuardCurrentContext&&) = delete;
-
-		FGuardCurrentContext(const FGuardCurrentContext&) = delete;
-		FGuardCurrentContext& operator=(const FGuardCurrentContext&) = delete;
-
-	private:
-
-		ImGuiContext* OldContext = nullptr;
-		bool bRestore = true;
-	};
+		static FString SaveDirectory = GetSaveDirectory();
+		return FPaths::IsRelative(Filename) ? FPaths::Combine(SaveDirectory, Filename) : Filename;
+	}
 }
 
 FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextIndex, ImFontAtlas* InFontAtlas, float InDPIScale)
@@ -100,9 +74,16 @@ FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextInd
 	, ContextIndex(InContextIndex)
 	, IniFilename(GetIniFile(InName))
 {
+	// Create allocator and install it before creating context, so the context itself is allocated from it.
+	Allocator = FImGuiContextAllocator::Create(InName);
+	Allocator->Install();
+
 	// Create context.
 	Context = ImGui::CreateContext(InFontAtlas);
 
+	// Create matching ImPlot context (it is allocated from the same allocator).
+	PlotContext = ImPlot::CreateContext();
+
 	// Set this context in ImGui for initialization (any allocations will be tracked in this context).
 	SetAsCurrent();
 
@@ -139,12 +120,32 @@ FImGuiContextProxy::~FImGuiContextProxy()
 		// Ensure frame has ended
 		EndFrame();	
 
+		// Continue with the main context, if the last frame was skipped.
+		if (SkippedFrameContext)
+		{
+			bIsFrameSkipped = false;
+			SetAsCurrent();
+
+			ImPlot::DestroyContext(SkippedFramePlotContext);
+			SkippedFramePlotContext = nullptr;
+
+			ImGui::DestroyContext(SkippedFrameContext);
+			SkippedFrameContext = nullptr;
+		}
+
 		// Manually save data session.
 		ImGui::SaveIniSettingsToDisk(StringCast<ANSICHAR>(*IniFilename).Get());
 		
+		// ImPlot context needs the ImGui context to be valid, so we destroy it first.
+		ImPlot::DestroyContext(PlotContext);
+		PlotContext = nullptr;
+
 		// Save context data and destroy.
 		ImGui::DestroyContext(Context);
 	}
+
+	// Allocator will be deleted after all its memory is returned.
+	Allocator->Release();
 }
 
 void FImGuiContextProxy::ResetDisplaySize()
@@ -161,8 +162,9 @@ void FImGuiContextProxy::SetDPIScale(float Scale)
 		ImGuiStyle NewStyle = ImGuiStyle();
 		NewStyle.ScaleAllSizes(Scale);
 
+		// Style is set in the main context, even if the current frame is skipped.
 		FGuardCurrentContext GuardContext;
-		SetAsCurrent();
+		ImGui::SetCurrentContext(Context);
 		ImGui::GetStyle() = MoveTemp(NewStyle);
 	}
 }
@@ -173,11 +175,15 @@ void FImGuiContextProxy::DrawEarlyDebug()
 	{
 		bIsDrawEarlyDebugCalled = true;
 
-		SetAsCurrent();
+		// Delegates are not called in frames skipped between updates.
+		if (!bIsFrameSkipped)
+		{
+			SetAsCurrent();
 
-		// Delegates called in order specified in FImGuiDelegates.
-		BroadcastMultiContextEarlyDebug();
-		BroadcastWorldEarlyDebug();
+			// Delegates called in order specified in FImGuiDelegates.
+			BroadcastMultiContextEarlyDebug();
+			BroadcastWorldEarlyDebug();
+		}
 	}
 }
 
@@ -190,11 +196,19 @@ void FImGuiContextProxy::DrawDebug()
 		// Make sure that early debug is always called first to guarantee order specified in FImGuiDelegates.
 		DrawEarlyDebug();
 
-		SetAsCurrent();
+		// Delegates are not called in frames skipped between updates. Commands recorded on other threads stay queued
+		// until the next update.
+		if (!bIsFrameSkipped)
+		{
+			SetAsCurrent();
+
+			// Delegates called in order specified in FImGuiDelegates.
+			BroadcastWorldDebug();
+			BroadcastMultiContextDebug();
 
-		// Delegates called in order specified in FImGuiDelegates.
-		BroadcastWorldDebug();
-		BroadcastMultiContextDebug();
+			// Commands recorded on other threads are drawn after all debug delegates.
+			DeferredDrawQueue->Draw();
+		}
 	}
 }
 
@@ -205,6 +219,17 @@ void FImGuiContextProxy::Tick(float DeltaSeconds)
 	{
 		LastFrameNumber = GFrameNumber;
 
+		// With an external source, context is frozen and frames from that source are presented instead of its output.
+		if (DrawDataSource)
+		{
+			if (DrawDataSource->ReadFrame(DrawLists))
+			{
+				PackDrawLists();
+				DrawDataVersion++;
+			}
+			return;
+		}
+
 		SetAsCurrent();
 
 		if (bIsFrameStarted)
@@ -217,33 +242,66 @@ void FImGuiContextProxy::Tick(float DeltaSeconds)
 			EndFrame();
 		}
 
+		// With a target update rate, context is only updated when the update interval elapses. Frames in between are
+		// skipped: draw data and their version stay unchanged and input is queued in the context until the next update.
+		AccumulatedDeltaTime += DeltaSeconds;
+		bIsFrameSkipped = (TargetUpdateRate > 0.f) && (AccumulatedDeltaTime < 1.f / TargetUpdateRate);
+		if (bIsFrameSkipped)
+		{
+			// ImGui code called outside of debug delegates still needs a frame to draw to.
+			CreateSkippedFrameContext();
+			SetAsCurrent();
+			BeginFrame(DeltaSeconds);
+			return;
+		}
+
+		SetAsCurrent();
+
 		// Update context information (some data need to be collected before starting a new frame while some other data
 		// may need to be collected after).
 		bHasActiveItem = ImGui::IsAnyItemActive();
 		MouseCursor = ImGuiInterops::ToSlateMouseCursor(ImGui::GetMouseCursor());
 
-		// Begin a new frame and set the context back to a state in which it allows to draw controls.
-		BeginFrame(DeltaSeconds);
+		// Begin a new frame and set the context back to a state in which it allows to draw controls. Frame time covers
+		// all frames skipped since the last update.
+		BeginFrame(AccumulatedDeltaTime);
+		AccumulatedDeltaTime = 0.f;
 
 		// Update remaining context information.
 		bWantsMouseCapture = ImGui::GetIO().WantCaptureMouse;
 	}
 }
 
+void FImGuiContextProxy::CreateSkippedFrameContext()
+{
+	if (!SkippedFrameContext)
+	{
+		// Context shares fonts with the main context, but it doesn't have an ini file or input.
+		SkippedFrameContext = ImGui::CreateContext(ImGui::GetIO().Fonts);
+		ImGui::SetCurrentContext(SkippedFrameContext);
+		SkippedFramePlotContext = ImPlot::CreateContext();
+		ImGui::GetIO().IniFilename = nullptr;
+	}
+}
+
 void FImGuiContextProxy::BeginFrame(float DeltaTime)
 {
 	if (!bIsFrameStarted)
 	{
+		Allocator->NextFrame();
+
 		ImGuiIO& IO = ImGui::GetIO();
 		IO.DeltaTime = DeltaTime;
 
-		InputState.SetCurrentFrameIO(&IO);
-		InputState.ClearUpdateState();
-
-
+		// Input is only consumed by the main context.
+		if (!bIsFrameSkipped)
+		{
+			InputState.SetCurrentFrameIO(&IO);
+			InputState.ClearUpdateState();
+		}
 
 		IO.DisplaySize = ImVec2(DisplaySize.X, DisplaySize.Y);
-		
+
 		ImGui::NewFrame();
 
 		bIsFrameStarted = true;
@@ -254,7 +312,13 @@ void FImGuiContextProxy::BeginFrame(float DeltaTime)
 
 void FImGuiContextProxy::EndFrame()
 {
-	if (bIsFrameStarted)
+	if (bIsFrameStarted && bIsFrameSkipped)
+	{
+		// Output of skipped frames is discarded, so they are ended without rendering.
+		ImGui::EndFrame();
+		bIsFrameStarted = false;
+	}
+	else if (bIsFrameStarted)
 	{
 		// Prepare draw data (after this call we cannot draw to this context until we start a new frame).
 		ImGui::Render();
@@ -267,25 +331,82 @@ void FImGuiContextProxy::EndFrame()
 	}
 }
 
+void FImGuiContextProxy::PackDrawLists()
+{
+	// Lists are bound to the current arena or store their own data, so it is safe to pack them into the other one.
+	CurrentDrawDataArena ^= 1;
+	DrawDataArenas[CurrentDrawDataArena].Pack(DrawLists);
+}
+
+const FImGuiDrawBatches& FImGuiContextProxy::GetDrawBatches() const
+{
+	if (DrawBatchesVersion != DrawDataVersion)
+	{
+		DrawBatches.Build(DrawLists);
+		DrawBatchesVersion = DrawDataVersion;
+	}
+
+	return DrawBatches;
+}
+
 void FImGuiContextProxy::UpdateDrawData(ImDrawData* DrawData)
 {
+	DrawDataVersion++;
+
 	if (DrawData && DrawData->CmdListsCount > 0)
 	{
-#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4)
-		DrawLists.SetNum(DrawData->CmdListsCount, EAllowShrinking::No);
-#else
-		DrawLists.SetNum(DrawData->CmdListsCount, false);
-#endif
-		for (int Index = 0; Index < DrawData->CmdListsCount; Index++)
-		{
-			DrawLists[Index].TransferDrawData(*DrawData->CmdLists[Index]);
-		}
+		// Pack the whole frame into one arena. Arenas are swapped every frame, so data of the previous frame stay
+		// valid while the next one is packed.
+		CurrentDrawDataArena ^= 1;
+		DrawDataArenas[CurrentDrawDataArena].Pack(*DrawData, DrawLists);
 	}
 	else
 	{
 		// If we are not rendering then this might be a good moment to empty the array.
 		DrawLists.Empty();
 	}
+
+	if (Capture)
+	{
+		Capture->AddFrame(DrawLists);
+	}
+}
+
+bool FImGuiContextProxy::StartCapture(const FString& Filename)
+{
+	StopCapture();
+	Capture = FImGuiDrawDataCapture::Create(GetCaptureFile(Filename));
+	return Capture.IsValid();
+}
+
+void FImGuiContextProxy::StopCapture()
+{
+	Capture.Reset();
+}
+
+bool FImGuiContextProxy::StartReplay(const FString& Filename)
+{
+	TSharedPtr<FImGuiDrawDataReplay> Replay = FImGuiDrawDataReplay::Create(GetCaptureFile(Filename));
+	if (Replay)
+	{
+		SetDrawDataSource(Replay);
+	}
+	return Replay.IsValid();
+}
+
+void FImGuiContextProxy::SetDrawDataSource(const TSharedPtr<IImGuiDrawDataSource>& Source)
+{
+	if (DrawDataSource != Source)
+	{
+		// Don't capture data from external sources.
+		StopCapture();
+
+		DrawDataSource = Source;
+
+		// Clear the current frame, so it is not presented until the next update.
+		DrawLists.Empty();
+		DrawDataVersion++;
+	}
 }
 
 void FImGuiContextProxy::BroadcastWorldEarlyDebug()
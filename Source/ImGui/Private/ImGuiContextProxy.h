@@ -24,13 +24,17 @@
 
 #pragma once
 
+#include "ImGuiContextAllocator.h"
+#include "ImGuiDeferredDrawQueue.h"
 #include "ImGuiDrawData.h"
+#include "ImGuiDrawDataCapture.h"
 #include "ImGuiInputState.h"
 #include "Utilities/WorldContextIndex.h"
 
 #include <GenericPlatform/ICursor.h>
 
 #include <imgui.h>
+#include <implot.h>
 
 // Represents a single ImGui context. All the context updates should be done through this proxy. During update it
 // broadcasts draw events to allow listeners draw their controls. After update it stores draw data.
@@ -53,15 +57,77 @@ public:
 	// Get draw data from the last frame.
 	const TArray<FImGuiDrawList>& GetDrawData() const { return DrawLists; }
 
+	// Get version of the draw data, incremented every time when draw data are updated. Can be used to detect that the
+	// same output is presented again.
+	uint32 GetDrawDataVersion() const { return DrawDataVersion; }
+
+	// Get draw data from the last frame merged into batches. Batches are built when first requested after draw data
+	// are updated.
+	const FImGuiDrawBatches& GetDrawBatches() const;
+
 	// Get input state used by this context.
 	FImGuiInputState& GetInputState() { return InputState; }
 	const FImGuiInputState& GetInputState() const { return InputState; }
 
 	// Is this context the current ImGui context.
-	bool IsCurrentContext() const { return ImGui::GetCurrentContext() == Context; }
-
-	// Set this context as current ImGui context.
-	void SetAsCurrent() { ImGui::SetCurrentContext(Context); }
+	bool IsCurrentContext() const { return ImGui::GetCurrentContext() == GetActiveContext(); }
+
+	// Restores ImGui and ImPlot contexts and allocator which were current when it was created.
+	struct FGuardCurrentContext
+	{
+		FGuardCurrentContext()
+			: OldContext(ImGui::GetCurrentContext())
+			, OldPlotContext(ImPlot::GetCurrentContext())
+		{
+			ImGui::GetAllocatorFunctions(&OldAllocFunc, &OldFreeFunc, &OldAllocatorUserData);
+		}
+
+		~FGuardCurrentContext()
+		{
+			if (bRestore)
+			{
+				ImGui::SetCurrentContext(OldContext);
+				ImPlot::SetCurrentContext(OldPlotContext);
+				ImGui::SetAllocatorFunctions(OldAllocFunc, OldFreeFunc, OldAllocatorUserData);
+			}
+		}
+
+		FGuardCurrentContext(FGuardCurrentContext&& Other)
+			: OldContext(MoveTemp(Other.OldContext))
+			, OldPlotContext(MoveTemp(Other.OldPlotContext))
+			, OldAllocFunc(Other.OldAllocFunc)
+			, OldFreeFunc(Other.OldFreeFunc)
+			, OldAllocatorUserData(Other.OldAllocatorUserData)
+		{
+			Other.bRestore = false;
+		}
+
+		FGuardCurrentContext& operator=(FGuardCurrentContext&&) = delete;
+
+		FGuardCurrentContext(const FGuardCurrentContext&) = delete;
+		FGuardCurrentContext& operator=(const FGuardCurrentContext&) = delete;
+
+	private:
+
+		ImGuiContext* OldContext = nullptr;
+		ImPlotContext* OldPlotContext = nullptr;
+		ImGuiMemAllocFunc OldAllocFunc = nullptr;
+		ImGuiMemFreeFunc OldFreeFunc = nullptr;
+		void* OldAllocatorUserData = nullptr;
+		bool bRestore = true;
+	};
+
+	// Set this context as current ImGui context. This also installs the context allocator. Between updates throttled
+	// by the target update rate, this sets a context which discards its output (see SetTargetUpdateRate).
+	void SetAsCurrent()
+	{
+		ImGui::SetCurrentContext(GetActiveContext());
+		ImPlot::SetCurrentContext(bIsFrameSkipped ? SkippedFramePlotContext : PlotContext);
+		Allocator->Install();
+	}
+
+	// Get the allocator used by this context (gives access to memory statistics).
+	const FImGuiContextAllocator& GetAllocator() const { return *Allocator; }
 
 	// Get the desired context display size.
 	const FVector2D& GetDisplaySize() const { return DisplaySize; }
@@ -78,6 +144,16 @@ public:
 	// Set the DPI scale for this context.
 	void SetDPIScale(float Scale);
 
+	// Get the target number of updates per second. Zero means that this context is updated in every frame.
+	float GetTargetUpdateRate() const { return TargetUpdateRate; }
+
+	// Set the target number of updates per second. Between updates, the context doesn't start new frames and the last
+	// draw data are presented again without changing their version. Input is queued until the next update. Debug
+	// delegates are not called and ImGui code called from other places (like actor ticks) draws to a context which
+	// discards its output.
+	// @param Rate - Number of updates per second or zero to update in every frame
+	void SetTargetUpdateRate(float Rate) { TargetUpdateRate = FMath::Max(Rate, 0.f); }
+
 	// Whether this context has an active item (read once per frame during context update).
 	bool HasActiveItem() const { return bHasActiveItem; }
 
@@ -91,6 +167,9 @@ public:
 	// passed when the module is reloaded, so all objects that are unloaded with the module should register here.
 	FSimpleMulticastDelegate& OnDraw() { return DrawEvent; }
 
+	// Get the queue of draw commands recorded on other threads, drawn after debug events.
+	const TSharedRef<FImGuiDeferredDrawQueue, ESPMode::ThreadSafe>& GetDeferredDrawQueue() const { return DeferredDrawQueue; }
+
 	// Call early debug events to allow listeners draw their debug widgets.
 	void DrawEarlyDebug();
 
@@ -100,12 +179,45 @@ public:
 	// Tick to advance context to the next frame. Only one call per frame will be processed.
 	void Tick(float DeltaSeconds);
 
+	// Start capturing draw data of every update to a file.
+	// @param Filename - Path to the capture file, relative paths are resolved against the ImGui saved directory
+	// @returns True, if capture was started
+	bool StartCapture(const FString& Filename);
+
+	// Stop capturing draw data and close the capture file.
+	void StopCapture();
+
+	// Whether draw data are being captured.
+	bool IsCapturing() const { return Capture.IsValid(); }
+
+	// Start replaying draw data from a capture file (see SetDrawDataSource).
+	// @param Filename - Path to the capture file, relative paths are resolved against the ImGui saved directory
+	// @returns True, if replay was started
+	bool StartReplay(const FString& Filename);
+
+	// Stop replaying draw data and resume normal updates.
+	void StopReplay() { SetDrawDataSource(nullptr); }
+
+	// Set a source of draw data that replaces the output of this context. While source is set, context is not
+	// updated and its draw data are replaced with frames read from the source, without calling debug delegates.
+	// Input events are still queued in this context.
+	// @param Source - Source of draw data or null to resume normal updates
+	void SetDrawDataSource(const TSharedPtr<IImGuiDrawDataSource>& Source);
+
+	// Whether draw data are read from an external source.
+	bool HasDrawDataSource() const { return DrawDataSource.IsValid(); }
+
 private:
 
+	ImGuiContext* GetActiveContext() const { return bIsFrameSkipped ? SkippedFrameContext : Context; }
+
 	void BeginFrame(float DeltaTime = 1.f / 60.f);
 	void EndFrame();
 
+	void CreateSkippedFrameContext();
+
 	void UpdateDrawData(ImDrawData* DrawData);
+	void PackDrawLists();
 
 	void BroadcastWorldEarlyDebug();
 	void BroadcastMultiContextEarlyDebug();
@@ -115,9 +227,24 @@ private:
 
 	ImGuiContext* Context;
 
+	// ImPlot context matching the ImGui context. Both are created and destroyed together.
+	ImPlotContext* PlotContext = nullptr;
+
+	// Owned by this proxy but released rather than deleted, as it may need to outlive the context.
+	FImGuiContextAllocator* Allocator = nullptr;
+
 	FVector2D DisplaySize = FVector2D::ZeroVector;
 	float DPIScale = 1.f;
 
+	float TargetUpdateRate = 0.f;
+	float AccumulatedDeltaTime = 0.f;
+
+	// Context set as current in frames skipped between updates, so ImGui code called outside of debug delegates still
+	// has a frame to draw to. Its frames are ended without rendering. Created when first needed.
+	ImGuiContext* SkippedFrameContext = nullptr;
+	ImPlotContext* SkippedFramePlotContext = nullptr;
+	bool bIsFrameSkipped = false;
+
 	EMouseCursor::Type MouseCursor = EMouseCursor::None;
 	bool bHasActiveItem = false;
 	bool bWantsMouseCapture = false;
@@ -129,6 +256,17 @@ private:
 	FImGuiInputState InputState;
 
 	TArray<FImGuiDrawList> DrawLists;
+	uint32 DrawDataVersion = 0;
+
+	// Double-buffered arenas storing draw data of the last two frames.
+	FImGuiDrawDataArena DrawDataArenas[2];
+	int32 CurrentDrawDataArena = 0;
+
+	mutable FImGuiDrawBatches DrawBatches;
+	mutable uint32 DrawBatchesVersion = 0;
+
+	TUniquePtr<FImGuiDrawDataCapture> Capture;
+	TSharedPtr<IImGuiDrawDataSource> DrawDataSource;
 
 	FString Name;
 	int32 ContextIndex = Utilities::INVALID_CONTEXT_INDEX;
@@ -137,5 +275,7 @@ private:
 
 	FSimpleMulticastDelegate DrawEvent;
 
+	TSharedRef<FImGuiDeferredDrawQueue, ESPMode::ThreadSafe> DeferredDrawQueue = MakeShared<FImGuiDeferredDrawQueue, ESPMode::ThreadSafe>();
+
 	FString IniFilename;
 };
@@ -0,0 +1,291 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ImGuiDeferredDraw.h"
+
+#include "ImGuiDeferredDrawQueue.h"
+#include "ImGuiInteroperability.h"
+
+#include <imgui.h>
+#include <implot.h>
+
+
+namespace
+{
+	// Estimate of memory held by a queued command, including the queue node.
+	int32 GetCommandSize(const FImGuiDeferredDrawCommand& Command)
+	{
+		return static_cast<int32>(sizeof(FImGuiDeferredDrawCommand) + sizeof(void*) + Command.Text.GetAllocatedSize());
+	}
+}
+
+//====================================================================================================
+// Producer
+//====================================================================================================
+
+FImGuiDeferredDrawProducer::FImGuiDeferredDrawProducer(const FString& InName, int32 InMaxPendingBytes,
+	const TSharedRef<FImGuiDeferredDrawQueue, ESPMode::ThreadSafe>& InQueue)
+	: Queue(InQueue)
+	, Name(InName)
+	, MaxPendingBytes(FMath::Max(InMaxPendingBytes, 0))
+{
+}
+
+FImGuiDeferredDrawProducer::~FImGuiDeferredDrawProducer()
+{
+}
+
+bool FImGuiDeferredDrawProducer::Text(const FName& Window, FString Text)
+{
+	FImGuiDeferredDrawCommand Command;
+	Command.Type = EImGuiDeferredDrawCommandType::Text;
+	Command.Name = Window;
+	Command.Text = MoveTemp(Text);
+	return Push(MoveTemp(Command));
+}
+
+bool FImGuiDeferredDrawProducer::SetText(const FName& Window, FString Text)
+{
+	FImGuiDeferredDrawCommand Command;
+	Command.Type = EImGuiDeferredDrawCommandType::SetText;
+	Command.Name = Window;
+	Command.Text = MoveTemp(Text);
+	return Push(MoveTemp(Command));
+}
+
+bool FImGuiDeferredDrawProducer::ClearText(const FName& Window)
+{
+	FImGuiDeferredDrawCommand Command;
+	Command.Type = EImGuiDeferredDrawCommandType::ClearText;
+	Command.Name = Window;
+	return Push(MoveTemp(Command));
+}
+
+bool FImGuiDeferredDrawProducer::Line(const FVector2D& From, const FVector2D& To, const FColor& Color, float Thickness)
+{
+	FImGuiDeferredDrawCommand Command;
+	Command.Type = EImGuiDeferredDrawCommandType::Line;
+	Command.A = From;
+	Command.B = To;
+	Command.Color = Color;
+	Command.Thickness = Thickness;
+	return Push(MoveTemp(Command));
+}
+
+bool FImGuiDeferredDrawProducer::Rect(const FVector2D& Min, const FVector2D& Max, const FColor& Color, float Thickness, bool bFilled)
+{
+	FImGuiDeferredDrawCommand Command;
+	Command.Type = EImGuiDeferredDrawCommandType::Rect;
+	Command.A = Min;
+	Command.B = Max;
+	Command.Color = Color;
+	Command.Thickness = Thickness;
+	Command.bFilled = bFilled;
+	return Push(MoveTemp(Command));
+}
+
+bool FImGuiDeferredDrawProducer::Circle(const FVector2D& Center, float Radius, const FColor& Color, float Thickness, bool bFilled)
+{
+	FImGuiDeferredDrawCommand Command;
+	Command.Type = EImGuiDeferredDrawCommandType::Circle;
+	Command.A = Center;
+	Command.Radius = Radius;
+	Command.Color = Color;
+	Command.Thickness = Thickness;
+	Command.bFilled = bFilled;
+	return Push(MoveTemp(Command));
+}
+
+bool FImGuiDeferredDrawProducer::PlotSample(const FName& Plot, const FName& Series, double X, double Y)
+{
+	FImGuiDeferredDrawCommand Command;
+	Command.Type = EImGuiDeferredDrawCommandType::PlotSample;
+	Command.Name = Plot;
+	Command.Series = Series;
+	Command.X = X;
+	Command.Y = Y;
+	return Push(MoveTemp(Command));
+}
+
+bool FImGuiDeferredDrawProducer::Push(FImGuiDeferredDrawCommand&& Command)
+{
+	TSharedPtr<FImGuiDeferredDrawQueue, ESPMode::ThreadSafe> PinnedQueue = Queue.Pin();
+	if (!PinnedQueue)
+	{
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	// Reserve budget before queuing, so concurrent pushes cannot exceed it together.
+	const int32 Size = GetCommandSize(Command);
+	if (PendingBytes.fetch_add(Size, std::memory_order_relaxed) + Size > MaxPendingBytes)
+	{
+		PendingBytes.fetch_sub(Size, std::memory_order_relaxed);
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	Command.Size = Size;
+	Command.Producer = AsShared();
+	PinnedQueue->Push(MoveTemp(Command));
+
+	NumQueued.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+//====================================================================================================
+// Queue
+//====================================================================================================
+
+void FImGuiDeferredDrawQueue::Push(FImGuiDeferredDrawCommand&& Command)
+{
+	Commands.Enqueue(MoveTemp(Command));
+	NumCommands.fetch_add(1, std::memory_order_release);
+}
+
+void FImGuiDeferredDrawQueue::Draw()
+{
+	// Commands are counted after they are queued, so this is never more than what can be dequeued.
+	const int32 NumToDrain = NumCommands.load(std::memory_order_acquire);
+	if (NumToDrain > 0)
+	{
+		ImDrawList* BackgroundDrawList = ImGui::GetBackgroundDrawList();
+
+		FImGuiDeferredDrawCommand Command;
+		int32 NumDrained = 0;
+		for (; NumDrained < NumToDrain && Commands.Dequeue(Command); NumDrained++)
+		{
+			switch (Command.Type)
+			{
+			case EImGuiDeferredDrawCommandType::Text:
+			{
+				TArray<FString>& Lines = TextWindows.FindOrAdd(Command.Name).Lines;
+				if (Lines.Num() >= MaxTextLines)
+				{
+					Lines.RemoveAt(0, Lines.Num() - MaxTextLines + 1);
+				}
+				Lines.Add(MoveTemp(Command.Text));
+				break;
+			}
+
+			case EImGuiDeferredDrawCommandType::SetText:
+			{
+				TArray<FString>& Lines = TextWindows.FindOrAdd(Command.Name).Lines;
+				Lines.Reset();
+				Lines.Add(MoveTemp(Command.Text));
+				break;
+			}
+
+			case EImGuiDeferredDrawCommandType::ClearText:
+				TextWindows.Remove(Command.Name);
+				break;
+
+			case EImGuiDeferredDrawCommandType::Line:
+				BackgroundDrawList->AddLine(ImGuiInterops::ToImVec2(Command.A), ImGuiInterops::ToImVec2(Command.B),
+					ImGuiInterops::PackImU32Color(Command.Color), Command.Thickness);
+				break;
+
+			case EImGuiDeferredDrawCommandType::Rect:
+				if (Command.bFilled)
+				{
+					BackgroundDrawList->AddRectFilled(ImGuiInterops::ToImVec2(Command.A), ImGuiInterops::ToImVec2(Command.B),
+						ImGuiInterops::PackImU32Color(Command.Color));
+				}
+				else
+				{
+					BackgroundDrawList->AddRect(ImGuiInterops::ToImVec2(Command.A), ImGuiInterops::ToImVec2(Command.B),
+						ImGuiInterops::PackImU32Color(Command.Color), 0.f, 0, Command.Thickness);
+				}
+				break;
+
+			case EImGuiDeferredDrawCommandType::Circle:
+				if (Command.bFilled)
+				{
+					BackgroundDrawList->AddCircleFilled(ImGuiInterops::ToImVec2(Command.A), Command.Radius,
+						ImGuiInterops::PackImU32Color(Command.Color));
+				}
+				else
+				{
+					BackgroundDrawList->AddCircle(ImGuiInterops::ToImVec2(Command.A), Command.Radius,
+						ImGuiInterops::PackImU32Color(Command.Color), 0, Command.Thickness);
+				}
+				break;
+
+			case EImGuiDeferredDrawCommandType::PlotSample:
+			{
+				TUniquePtr<TImGuiPlotRingBuffer<ImPlotPoint>>& Series = Plots.FindOrAdd(Command.Name).Series.FindOrAdd(Command.Series);
+				if (!Series)
+				{
+					Series = MakeUnique<TImGuiPlotRingBuffer<ImPlotPoint>>(MaxPlotSamples);
+				}
+				Series->Push(ImPlotPoint(Command.X, Command.Y));
+				break;
+			}
+			}
+
+			Command.Producer->Release(Command.Size);
+			Command.Producer.Reset();
+		}
+
+		NumCommands.fetch_sub(NumDrained, std::memory_order_relaxed);
+	}
+
+	DrawTextWindows();
+	DrawPlots();
+}
+
+void FImGuiDeferredDrawQueue::DrawTextWindows()
+{
+	for (const auto& Window : TextWindows)
+	{
+		if (ImGui::Begin(TCHAR_TO_UTF8(*Window.Key.ToString())))
+		{
+			for (const FString& Line : Window.Value.Lines)
+			{
+				ImGui::TextUnformatted(TCHAR_TO_UTF8(*Line));
+			}
+		}
+		ImGui::End();
+	}
+}
+
+void FImGuiDeferredDrawQueue::DrawPlots()
+{
+	for (const auto& Plot : Plots)
+	{
+		if (ImGui::Begin(TCHAR_TO_UTF8(*Plot.Key.ToString())))
+		{
+			if (ImPlot::BeginPlot("##Samples", ImVec2(-1.f, -1.f)))
+			{
+				ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+				for (const auto& Series : Plot.Value.Series)
+				{
+					Series.Value->PlotLine(TCHAR_TO_UTF8(*Series.Key.ToString()));
+				}
+				ImPlot::EndPlot();
+			}
+		}
+		ImGui::End();
+	}
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "ImGuiDeferredDraw.h"
+#include "ImGuiPlotRingBuffer.h"
+
+#include <Containers/Queue.h>
+
+#include <atomic>
+
+
+enum class EImGuiDeferredDrawCommandType : uint8
+{
+	Text,
+	SetText,
+	ClearText,
+	Line,
+	Rect,
+	Circle,
+	PlotSample
+};
+
+// Primitive recorded by a producer. Fields are interpreted depending on command type.
+struct FImGuiDeferredDrawCommand
+{
+	// Producer that queued this command, kept alive until its budget is returned.
+	TSharedPtr<FImGuiDeferredDrawProducer, ESPMode::ThreadSafe> Producer;
+
+	// Window or plot name and series name.
+	FName Name;
+	FName Series;
+
+	FString Text;
+
+	// Line end points, rectangle corners or circle center; plot samples store their coordinates in X and Y.
+	FVector2D A = FVector2D::ZeroVector;
+	FVector2D B = FVector2D::ZeroVector;
+	double X = 0.0;
+	double Y = 0.0;
+
+	float Thickness = 1.f;
+	float Radius = 0.f;
+	FColor Color = FColor::White;
+
+	// Number of bytes charged to the producer's budget.
+	int32 Size = 0;
+
+	EImGuiDeferredDrawCommandType Type = EImGuiDeferredDrawCommandType::Text;
+	bool bFilled = false;
+};
+
+// Lock-free multiple-producer, single-consumer queue of deferred draw commands owned by a single context. Commands can
+// be pushed from any thread, while draining and drawing needs to happen on the game thread, with the owning context
+// set as current. Producers only keep weak references to the queue, so commands pushed after the context is destroyed
+// are dropped.
+class FImGuiDeferredDrawQueue
+{
+public:
+
+	// Maximal number of the most recent lines visible in each text window.
+	static constexpr int32 MaxTextLines = 256;
+
+	// Maximal number of the most recent samples visible in each plotted series.
+	static constexpr int32 MaxPlotSamples = 2048;
+
+	// Push a command to the queue. Can be called from any thread.
+	void Push(FImGuiDeferredDrawCommand&& Command);
+
+	// Drain commands queued before this call and draw them in the current context, together with retained text and
+	// plot windows. To guarantee progress with busy producers, commands queued while draining are left for the next
+	// frame.
+	void Draw();
+
+private:
+
+	struct FTextWindow
+	{
+		TArray<FString> Lines;
+	};
+
+	struct FPlot
+	{
+		TMap<FName, TUniquePtr<TImGuiPlotRingBuffer<ImPlotPoint>>> Series;
+	};
+
+	void DrawTextWindows();
+	void DrawPlots();
+
+	TQueue<FImGuiDeferredDrawCommand, EQueueMode::Mpsc> Commands;
+	std::atomic<int32> NumCommands{ 0 };
+
+	// Accessed only by the consumer.
+	TMap<FName, FTextWindow> TextWindows;
+	TMap<FName, FPlot> Plots;
+};
@@ -28,6 +28,8 @@
 
 #include <CoreGlobals.h>
 
+#include <implot.h>
+
 
 // Demo copied (with minor modifications) from ImGui examples. See https://github.com/ocornut/imgui.
 void FImGuiDemo::DrawControls(int32 ContextIndex)
@@ -48,6 +50,7 @@ void FImGuiDemo::DrawControls(int32 ContextIndex)
 			{
 				if (ImGui::Button("Demo Window")) ShowDemoWindowMask ^= ContextBit;
 				if (ImGui::Button("Another Window")) ShowAnotherWindowMask ^= ContextBit;
+				if (ImGui::Button("ImPlot Demo Window")) ShowPlotDemoWindowMask ^= ContextBit;
 			}
 			ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
 		}
@@ -101,5 +104,12 @@ void FImGuiDemo::DrawControls(int32 ContextIndex)
 			ImGui::SetNextWindowPos(ImVec2(650, 20), ImGuiCond_FirstUseEver);
 			ImGui::ShowDemoWindow();
 		}
+
+		// 4. Show the ImPlot demo window. It uses the ImPlot context created together with the ImGui context.
+		if (ShowPlotDemoWindowMask & ContextBit)
+		{
+			ImGui::SetNextWindowPos(ImVec2(700, 40), ImGuiCond_FirstUseEver);
+			ImPlot::ShowDemoWindow();
+		}
 	}
 }
@@ -50,6 +50,7 @@ private:
 
 	int32 ShowDemoWindowMask = 0;
 	int32 ShowAnotherWindowMask = 0;
+	int32 ShowPlotDemoWindowMask = 0;
 
 	int32 DemoWindowCounter = 0;
 	uint32 LastDemoWindowFrameNumber = 0;
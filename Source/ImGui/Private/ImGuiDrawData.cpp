@@ -24,6 +24,89 @@
 
 #include "ImGuiDrawData.h"
 
+#include "TextureManager.h"
+
+#include <Hash/CityHash.h>
+
+
+FSlateRect FImGuiDrawList::GetClippingBounds(const FTransform2D& Transform) const
+{
+	if (ImGuiCommandBuffer.Size == 0)
+	{
+		return FSlateRect{};
+	}
+
+	ImVec4 Bounds = ImGuiCommandBuffer[0].ClipRect;
+	for (int Idx = 1; Idx < ImGuiCommandBuffer.Size; Idx++)
+	{
+		const ImVec4& ClipRect = ImGuiCommandBuffer[Idx].ClipRect;
+		Bounds.x = FMath::Min(Bounds.x, ClipRect.x);
+		Bounds.y = FMath::Min(Bounds.y, ClipRect.y);
+		Bounds.z = FMath::Max(Bounds.z, ClipRect.z);
+		Bounds.w = FMath::Max(Bounds.w, ClipRect.w);
+	}
+
+	return TransformRect(Transform, ImGuiInterops::ToSlateRect(Bounds));
+}
+
+uint64 FImGuiDrawList::GetContentHash(const FTextureManager& TextureManager) const
+{
+	// Hash command fields one by one, as commands have padding and fields that are not relevant for output.
+	uint64 Hash = 0;
+	for (const ImDrawCmd& Command : ImGuiCommandBuffer)
+	{
+		const TextureIndex TextureId = ImGuiInterops::ToTextureIndex(Command.TextureId);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Command.ClipRect), sizeof(Command.ClipRect), Hash);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&TextureId), sizeof(TextureId), Hash);
+
+		// Textures can be updated in place, so their revisions are needed to detect changes in content.
+		const uint32 TextureRevision = TextureManager.GetTextureRevision(TextureId);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&TextureRevision), sizeof(TextureRevision), Hash);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Command.ElemCount), sizeof(Command.ElemCount), Hash);
+	}
+
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(ImGuiVertexBuffer.Data), ImGuiVertexBuffer.size_in_bytes(), Hash);
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(ImGuiIndexBuffer.Data), ImGuiIndexBuffer.size_in_bytes(), Hash);
+	return Hash;
+}
+
+namespace
+{
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	void ConvertVertices(FSlateVertex* OutVertices, const ImDrawVert* ImGuiVertices, int32 NumVertices, const FTransform2D& Transform,
+		const FSlateRotatedRect& VertexClippingRect)
+#else
+	void ConvertVertices(FSlateVertex* OutVertices, const ImDrawVert* ImGuiVertices, int32 NumVertices, const FTransform2D& Transform)
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	{
+		for (int32 Idx = 0; Idx < NumVertices; Idx++)
+		{
+			const ImDrawVert& ImGuiVertex = ImGuiVertices[Idx];
+			FSlateVertex& SlateVertex = OutVertices[Idx];
+
+			// Final UV is calculated in shader as XY * ZW, so we need set all components.
+			SlateVertex.TexCoords[0] = ImGuiVertex.uv.x;
+			SlateVertex.TexCoords[1] = ImGuiVertex.uv.y;
+			SlateVertex.TexCoords[2] = SlateVertex.TexCoords[3] = 1.f;
+
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+			const FVector2D VertexPosition = Transform.TransformPoint(ImGuiInterops::ToVector2D(ImGuiVertex.pos));
+			SlateVertex.Position[0] = VertexPosition.X;
+			SlateVertex.Position[1] = VertexPosition.Y;
+			SlateVertex.ClipRect = VertexClippingRect;
+#else
+#if ENGINE_COMPATIBILITY_LEGACY_VECTOR2F
+			SlateVertex.Position = Transform.TransformPoint(ImGuiInterops::ToVector2D(ImGuiVertex.pos));
+#else
+			SlateVertex.Position = (FVector2f)Transform.TransformPoint(ImGuiInterops::ToVector2D(ImGuiVertex.pos));
+#endif // ENGINE_COMPATIBILITY_LEGACY_VECTOR2F
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+			// Unpack ImU32 color.
+			SlateVertex.Color = ImGuiInterops::UnpackImU32Color(ImGuiVertex.col);
+		}
+	}
+}
 
 #if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform, const FSlateRotatedRect& VertexClippingRect) const
@@ -39,31 +122,38 @@ void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const
 #endif
 
 	// Transform and copy vertex data.
-	for (int Idx = 0; Idx < ImGuiVertexBuffer.Size; Idx++)
-	{
-		const ImDrawVert& ImGuiVertex = ImGuiVertexBuffer[Idx];
-		FSlateVertex& SlateVertex = OutVertexBuffer[Idx];
-
-		// Final UV is calculated in shader as XY * ZW, so we need set all components.
-		SlateVertex.TexCoords[0] = ImGuiVertex.uv.x;
-		SlateVertex.TexCoords[1] = ImGuiVertex.uv.y;
-		SlateVertex.TexCoords[2] = SlateVertex.TexCoords[3] = 1.f;
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	ConvertVertices(OutVertexBuffer.GetData(), ImGuiVertexBuffer.Data, ImGuiVertexBuffer.Size, Transform, VertexClippingRect);
+#else
+	ConvertVertices(OutVertexBuffer.GetData(), ImGuiVertexBuffer.Data, ImGuiVertexBuffer.Size, Transform);
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+}
 
 #if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-		const FVector2D VertexPosition = Transform.TransformPoint(ImGuiInterops::ToVector2D(ImGuiVertex.pos));
-		SlateVertex.Position[0] = VertexPosition.X;
-		SlateVertex.Position[1] = VertexPosition.Y;
-		SlateVertex.ClipRect = VertexClippingRect;
+void FImGuiDrawList::AppendVertexData(TArray<FSlateVertex>& OutVertexBuffer, int32 FirstVertex, int32 NumVertices, const FTransform2D& Transform,
+	const FSlateRotatedRect& VertexClippingRect) const
 #else
-#if ENGINE_COMPATIBILITY_LEGACY_VECTOR2F
-		SlateVertex.Position = Transform.TransformPoint(ImGuiInterops::ToVector2D(ImGuiVertex.pos));
+void FImGuiDrawList::AppendVertexData(TArray<FSlateVertex>& OutVertexBuffer, int32 FirstVertex, int32 NumVertices, const FTransform2D& Transform) const
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+{
+	checkf(FirstVertex >= 0 && FirstVertex + NumVertices <= ImGuiVertexBuffer.Size, TEXT("Invalid vertex range [%d, %d) in a list with %d vertices."),
+		FirstVertex, FirstVertex + NumVertices, ImGuiVertexBuffer.Size);
+
+	const int32 Offset = OutVertexBuffer.AddUninitialized(NumVertices);
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	ConvertVertices(OutVertexBuffer.GetData() + Offset, ImGuiVertexBuffer.Data + FirstVertex, NumVertices, Transform, VertexClippingRect);
 #else
-		SlateVertex.Position = (FVector2f)Transform.TransformPoint(ImGuiInterops::ToVector2D(ImGuiVertex.pos));
-#endif // ENGINE_COMPATIBILITY_LEGACY_VECTOR2F
+	ConvertVertices(OutVertexBuffer.GetData() + Offset, ImGuiVertexBuffer.Data + FirstVertex, NumVertices, Transform);
 #endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+}
 
-		// Unpack ImU32 color.
-		SlateVertex.Color = ImGuiInterops::UnpackImU32Color(ImGuiVertex.col);
+void FImGuiDrawList::AppendIndexData(TArray<SlateIndex>& OutIndexBuffer, int32 StartIndex, int32 NumElements, int32 IndexOffset) const
+{
+	const int32 Offset = OutIndexBuffer.AddUninitialized(NumElements);
+	SlateIndex* OutIndices = OutIndexBuffer.GetData() + Offset;
+	for (int32 i = 0; i < NumElements; i++)
+	{
+		OutIndices[i] = ImGuiIndexBuffer[StartIndex + i] + IndexOffset;
 	}
 }
 
@@ -83,10 +173,337 @@ void FImGuiDrawList::CopyIndexData(TArray<SlateIndex>& OutIndexBuffer, const int
 	}
 }
 
-void FImGuiDrawList::TransferDrawData(ImDrawList& Src)
+void FImGuiDrawList::AppendGeometry(TArray<ImDrawVert>& OutVertexBuffer, TArray<ImDrawIdx>& OutIndexBuffer) const
 {
-	// Move data from source to this list.
-	Src.CmdBuffer.swap(ImGuiCommandBuffer);
-	Src.IdxBuffer.swap(ImGuiIndexBuffer);
-	Src.VtxBuffer.swap(ImGuiVertexBuffer);
+	OutVertexBuffer.Append(ImGuiVertexBuffer.Data, ImGuiVertexBuffer.Size);
+	OutIndexBuffer.Append(ImGuiIndexBuffer.Data, ImGuiIndexBuffer.Size);
+}
+
+FImGuiDrawList& FImGuiDrawList::operator=(const FImGuiDrawList& Other)
+{
+	if (this != &Other)
+	{
+		CommandStorage.resize(Other.ImGuiCommandBuffer.Size);
+		IndexStorage.resize(Other.ImGuiIndexBuffer.Size);
+		VertexStorage.resize(Other.ImGuiVertexBuffer.Size);
+		FMemory::Memcpy(CommandStorage.Data, Other.ImGuiCommandBuffer.Data, Other.ImGuiCommandBuffer.size_in_bytes());
+		FMemory::Memcpy(IndexStorage.Data, Other.ImGuiIndexBuffer.Data, Other.ImGuiIndexBuffer.size_in_bytes());
+		FMemory::Memcpy(VertexStorage.Data, Other.ImGuiVertexBuffer.Data, Other.ImGuiVertexBuffer.size_in_bytes());
+		BindStorage();
+	}
+
+	return *this;
+}
+
+void FImGuiDrawList::BindStorage()
+{
+	ImGuiCommandBuffer = { CommandStorage.Data, CommandStorage.Size };
+	ImGuiIndexBuffer = { IndexStorage.Data, IndexStorage.Size };
+	ImGuiVertexBuffer = { VertexStorage.Data, VertexStorage.Size };
+}
+
+void FImGuiDrawList::RemapTextures(TFunctionRef<TextureIndex(TextureIndex)> Remap)
+{
+	for (ImDrawCmd& Command : ImGuiCommandBuffer)
+	{
+		Command.TextureId = ImGuiInterops::ToImTextureID(Remap(ImGuiInterops::ToTextureIndex(Command.TextureId)));
+	}
+}
+
+namespace
+{
+	// Command data in raw format.
+	struct FRawDrawCommand
+	{
+		ImVec4 ClipRect;
+		int32 TextureId;
+		uint32 ElemCount;
+	};
+
+	template<typename T>
+	void AppendRaw(TArray<uint8>& OutBuffer, const T* Src, int32 Count)
+	{
+		const int32 NumBytes = Count * sizeof(T);
+		const int32 Offset = OutBuffer.AddUninitialized(NumBytes);
+		FMemory::Memcpy(OutBuffer.GetData() + Offset, Src, NumBytes);
+	}
+
+	template<typename T>
+	bool ReadRaw(const uint8*& Data, const uint8* DataEnd, T* Dst, int32 Count)
+	{
+		const SIZE_T NumBytes = Count * sizeof(T);
+		if (Count < 0 || static_cast<SIZE_T>(DataEnd - Data) < NumBytes)
+		{
+			return false;
+		}
+
+		FMemory::Memcpy(Dst, Data, NumBytes);
+		Data += NumBytes;
+		return true;
+	}
+}
+
+void FImGuiDrawList::WriteRawData(TArray<uint8>& OutBuffer) const
+{
+	const int32 Counts[] = { ImGuiCommandBuffer.Size, ImGuiIndexBuffer.Size, ImGuiVertexBuffer.Size };
+	AppendRaw(OutBuffer, Counts, UE_ARRAY_COUNT(Counts));
+
+	for (const ImDrawCmd& Command : ImGuiCommandBuffer)
+	{
+		const FRawDrawCommand RawCommand{ Command.ClipRect, ImGuiInterops::ToTextureIndex(Command.TextureId), Command.ElemCount };
+		AppendRaw(OutBuffer, &RawCommand, 1);
+	}
+
+	AppendRaw(OutBuffer, ImGuiIndexBuffer.Data, ImGuiIndexBuffer.Size);
+	AppendRaw(OutBuffer, ImGuiVertexBuffer.Data, ImGuiVertexBuffer.Size);
+}
+
+bool FImGuiDrawList::ReadRawData(const uint8*& Data, const uint8* DataEnd)
+{
+	// Data can come from files or network, so everything is validated before this list is modified.
+	const uint8* Cursor = Data;
+
+	int32 Counts[3];
+	if (!ReadRaw(Cursor, DataEnd, Counts, UE_ARRAY_COUNT(Counts)) || Counts[0] < 0 || Counts[1] < 0 || Counts[2] < 0)
+	{
+		return false;
+	}
+
+	// Make sure that data can contain all elements, before allocating them.
+	const uint64 ExpectedSize = static_cast<uint64>(Counts[0]) * sizeof(FRawDrawCommand)
+		+ static_cast<uint64>(Counts[1]) * sizeof(ImDrawIdx) + static_cast<uint64>(Counts[2]) * sizeof(ImDrawVert);
+	if (ExpectedSize > static_cast<uint64>(DataEnd - Cursor))
+	{
+		return false;
+	}
+
+	ImVector<ImDrawCmd> Commands;
+	ImVector<ImDrawIdx> Indices;
+	ImVector<ImDrawVert> Vertices;
+	Commands.resize(Counts[0]);
+	Indices.resize(Counts[1]);
+	Vertices.resize(Counts[2]);
+
+	uint64 NumCommandIndices = 0;
+	for (ImDrawCmd& Command : Commands)
+	{
+		FRawDrawCommand RawCommand;
+		if (!ReadRaw(Cursor, DataEnd, &RawCommand, 1))
+		{
+			return false;
+		}
+
+		Command = ImDrawCmd();
+		Command.ClipRect = RawCommand.ClipRect;
+		Command.TextureId = ImGuiInterops::ToImTextureID(RawCommand.TextureId);
+		Command.ElemCount = RawCommand.ElemCount;
+
+		NumCommandIndices += RawCommand.ElemCount;
+	}
+
+	if (NumCommandIndices > static_cast<uint64>(Indices.Size)
+		|| !ReadRaw(Cursor, DataEnd, Indices.Data, Indices.Size)
+		|| !ReadRaw(Cursor, DataEnd, Vertices.Data, Vertices.Size))
+	{
+		return false;
+	}
+
+	// Commands are converted without bound checks, so all indices need to reference existing vertices.
+	for (const ImDrawIdx Index : Indices)
+	{
+		if (static_cast<int32>(Index) >= Vertices.Size)
+		{
+			return false;
+		}
+	}
+
+	CommandStorage.swap(Commands);
+	IndexStorage.swap(Indices);
+	VertexStorage.swap(Vertices);
+	BindStorage();
+
+	Data = Cursor;
+	return true;
+}
+
+void FImGuiDrawBatches::Build(const TArray<FImGuiDrawList>& DrawLists)
+{
+	Batches.Reset();
+	Commands.Reset();
+
+	// Whether geometry of all commands in the last batch is inside of their own clipping rectangles.
+	bool bLastBatchInsideClipping = false;
+
+	for (int32 DrawListIndex = 0; DrawListIndex < DrawLists.Num(); DrawListIndex++)
+	{
+		const FImGuiDrawList& DrawList = DrawLists[DrawListIndex];
+
+		int32 StartIndex = 0;
+		for (int32 CommandIndex = 0; CommandIndex < DrawList.ImGuiCommandBuffer.Size; CommandIndex++)
+		{
+			const ImDrawCmd& ImGuiCommand = DrawList.ImGuiCommandBuffer[CommandIndex];
+			const int32 NumIndices = static_cast<int32>(ImGuiCommand.ElemCount);
+			if (NumIndices == 0)
+			{
+				continue;
+			}
+
+			// Find the range of vertices used by this command. ImGui appends vertices in the same order as indices, so
+			// this range is normally tight and it can be converted without touching vertices of other commands.
+			int32 MinIndex = MAX_int32;
+			int32 MaxIndex = 0;
+			for (const ImDrawIdx* Index = DrawList.ImGuiIndexBuffer.Data + StartIndex, *IndexEnd = Index + NumIndices; Index < IndexEnd; Index++)
+			{
+				MinIndex = FMath::Min<int32>(MinIndex, *Index);
+				MaxIndex = FMath::Max<int32>(MaxIndex, *Index);
+			}
+
+			// Bounds of vertices in range are conservative, so at worst we miss some opportunities to merge.
+			ImVec2 BoundsMin{ FLT_MAX, FLT_MAX };
+			ImVec2 BoundsMax{ -FLT_MAX, -FLT_MAX };
+			for (int32 VertexIndex = MinIndex; VertexIndex <= MaxIndex; VertexIndex++)
+			{
+				const ImVec2& Position = DrawList.ImGuiVertexBuffer[VertexIndex].pos;
+				BoundsMin.x = FMath::Min(BoundsMin.x, Position.x);
+				BoundsMin.y = FMath::Min(BoundsMin.y, Position.y);
+				BoundsMax.x = FMath::Max(BoundsMax.x, Position.x);
+				BoundsMax.y = FMath::Max(BoundsMax.y, Position.y);
+			}
+
+			const ImVec4& ClipRect = ImGuiCommand.ClipRect;
+			const bool bInsideClipping = BoundsMin.x >= ClipRect.x && BoundsMin.y >= ClipRect.y
+				&& BoundsMax.x <= ClipRect.z && BoundsMax.y <= ClipRect.w;
+
+			const FSlateRect ClippingRect = ImGuiInterops::ToSlateRect(ClipRect);
+			const TextureIndex TextureId = ImGuiInterops::ToTextureIndex(ImGuiCommand.TextureId);
+
+			FImGuiDrawBatch* Batch = Batches.Num() > 0 ? &Batches.Last() : nullptr;
+			if (Batch && Batch->TextureId == TextureId
+				&& (Batch->ClippingRect == ClippingRect || (bLastBatchInsideClipping && bInsideClipping)))
+			{
+				Batch->ClippingRect = FSlateRect(
+					FMath::Min(Batch->ClippingRect.Left, ClippingRect.Left), FMath::Min(Batch->ClippingRect.Top, ClippingRect.Top),
+					FMath::Max(Batch->ClippingRect.Right, ClippingRect.Right), FMath::Max(Batch->ClippingRect.Bottom, ClippingRect.Bottom));
+				Batch->NumCommands++;
+				bLastBatchInsideClipping &= bInsideClipping;
+			}
+			else
+			{
+				Batches.Add({ ClippingRect, TextureId, Commands.Num(), 1 });
+				bLastBatchInsideClipping = bInsideClipping;
+			}
+
+			Commands.Add({ DrawListIndex, CommandIndex, StartIndex, NumIndices, MinIndex, MaxIndex - MinIndex + 1 });
+
+			StartIndex += NumIndices;
+		}
+	}
+}
+
+namespace
+{
+	// Data of a draw list that is packed into an arena.
+	struct FDrawListSource
+	{
+		const ImDrawCmd* Commands;
+		int32 NumCommands;
+		const ImDrawIdx* Indices;
+		int32 NumIndices;
+		const ImDrawVert* Vertices;
+		int32 NumVertices;
+	};
+
+	FORCEINLINE int32 AlignArenaOffset(int32 Offset)
+	{
+		return Align(Offset, FImGuiDrawDataArena::Alignment);
+	}
+}
+
+template<typename TSourceFunc>
+void FImGuiDrawDataArena::PackLists(int32 NumLists, TSourceFunc GetSource, TArray<FImGuiDrawList>& DrawLists)
+{
+	// Calculate layout first, so the arena is allocated only once (and not at all after reaching the high-water mark).
+	Offsets.SetNumUninitialized(NumLists);
+	int32 Size = 0;
+	for (int32 Index = 0; Index < NumLists; Index++)
+	{
+		const FDrawListSource Source = GetSource(Index);
+		FImGuiDrawListOffsets& ListOffsets = Offsets[Index];
+
+		ListOffsets.NumCommands = Source.NumCommands;
+		ListOffsets.NumIndices = Source.NumIndices;
+		ListOffsets.NumVertices = Source.NumVertices;
+
+		ListOffsets.Commands = Size;
+		Size = AlignArenaOffset(Size + Source.NumCommands * static_cast<int32>(sizeof(ImDrawCmd)));
+		ListOffsets.Indices = Size;
+		Size = AlignArenaOffset(Size + Source.NumIndices * static_cast<int32>(sizeof(ImDrawIdx)));
+		ListOffsets.Vertices = Size;
+		Size = AlignArenaOffset(Size + Source.NumVertices * static_cast<int32>(sizeof(ImDrawVert)));
+	}
+
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4)
+	Buffer.SetNumUninitialized(Size, EAllowShrinking::No);
+#else
+	Buffer.SetNumUninitialized(Size, false);
+#endif
+
+	uint8* Data = Buffer.GetData();
+	for (int32 Index = 0; Index < NumLists; Index++)
+	{
+		const FDrawListSource Source = GetSource(Index);
+		const FImGuiDrawListOffsets& ListOffsets = Offsets[Index];
+
+		ImDrawCmd* Commands = reinterpret_cast<ImDrawCmd*>(Data + ListOffsets.Commands);
+		ImDrawIdx* Indices = reinterpret_cast<ImDrawIdx*>(Data + ListOffsets.Indices);
+		ImDrawVert* Vertices = reinterpret_cast<ImDrawVert*>(Data + ListOffsets.Vertices);
+
+		FMemory::Memcpy(Commands, Source.Commands, Source.NumCommands * sizeof(ImDrawCmd));
+		FMemory::Memcpy(Indices, Source.Indices, Source.NumIndices * sizeof(ImDrawIdx));
+		FMemory::Memcpy(Vertices, Source.Vertices, Source.NumVertices * sizeof(ImDrawVert));
+
+		// Commands store offsets relative to their list, so they can be used with the packed layout directly.
+		uint32 IndexOffset = 0;
+		for (int32 CommandIndex = 0; CommandIndex < Source.NumCommands; CommandIndex++)
+		{
+			Commands[CommandIndex].IdxOffset = IndexOffset;
+			Commands[CommandIndex].VtxOffset = 0;
+			IndexOffset += Commands[CommandIndex].ElemCount;
+		}
+
+		// Bind list to the arena. Its own buffers are emptied but they keep their allocations.
+		FImGuiDrawList& DrawList = DrawLists[Index];
+		DrawList.ImGuiCommandBuffer = { Commands, Source.NumCommands };
+		DrawList.ImGuiIndexBuffer = { Indices, Source.NumIndices };
+		DrawList.ImGuiVertexBuffer = { Vertices, Source.NumVertices };
+		DrawList.CommandStorage.resize(0);
+		DrawList.IndexStorage.resize(0);
+		DrawList.VertexStorage.resize(0);
+	}
+}
+
+void FImGuiDrawDataArena::Pack(const ImDrawData& DrawData, TArray<FImGuiDrawList>& DrawLists)
+{
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4)
+	DrawLists.SetNum(DrawData.CmdListsCount, EAllowShrinking::No);
+#else
+	DrawLists.SetNum(DrawData.CmdListsCount, false);
+#endif
+
+	PackLists(DrawData.CmdListsCount, [&DrawData](int32 Index)
+	{
+		const ImDrawList& Source = *DrawData.CmdLists[Index];
+		return FDrawListSource{ Source.CmdBuffer.Data, Source.CmdBuffer.Size, Source.IdxBuffer.Data, Source.IdxBuffer.Size,
+			Source.VtxBuffer.Data, Source.VtxBuffer.Size };
+	}, DrawLists);
+}
+
+void FImGuiDrawDataArena::Pack(TArray<FImGuiDrawList>& DrawLists)
+{
+	PackLists(DrawLists.Num(), [&DrawLists](int32 Index)
+	{
+		const FImGuiDrawList& Source = DrawLists[Index];
+		return FDrawListSource{ Source.ImGuiCommandBuffer.Data, Source.ImGuiCommandBuffer.Size, Source.ImGuiIndexBuffer.Data,
+			Source.ImGuiIndexBuffer.Size, Source.ImGuiVertexBuffer.Data, Source.ImGuiVertexBuffer.Size };
+	}, DrawLists);
 }
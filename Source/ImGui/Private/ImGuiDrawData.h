@@ -32,6 +32,8 @@
 #include <imgui.h>
 
 
+class FTextureManager;
+
 // ImGui draw command data transformed for Slate.
 struct FImGuiDrawCommand
 {
@@ -40,14 +42,48 @@ struct FImGuiDrawCommand
 	TextureIndex TextureId;
 };
 
-// Wraps raw ImGui draw list data in utilities that transform them for Slate.
+// View of an array of draw list data, with the subset of ImVector interface used by draw lists.
+template<typename T>
+struct TImGuiDrawDataView
+{
+	T* Data = nullptr;
+	int Size = 0;
+
+	T& operator[](int Index) const { return Data[Index]; }
+	T* begin() const { return Data; }
+	T* end() const { return Data + Size; }
+	int size_in_bytes() const { return Size * static_cast<int>(sizeof(T)); }
+};
+
+// Wraps raw ImGui draw list data in utilities that transform them for Slate. Data are either stored in the list
+// (when read from raw data) or in a draw data arena shared by all lists of a frame (see FImGuiDrawDataArena).
 class FImGuiDrawList
 {
 public:
 
+	FImGuiDrawList() = default;
+
+	// Copies always store data in their own buffers, so they stay valid after the source arena is reused.
+	FImGuiDrawList(const FImGuiDrawList& Other) { *this = Other; }
+	FImGuiDrawList& operator=(const FImGuiDrawList& Other);
+
 	// Get the number of draw commands in this list.
 	FORCEINLINE int NumCommands() const { return ImGuiCommandBuffer.Size; }
 
+	// Get the number of vertices in this list.
+	FORCEINLINE int NumVertices() const { return ImGuiVertexBuffer.Size; }
+
+	// Get the bounds of the area that can be drawn by this list, calculated as a union of all clipping rectangles.
+	// @param Transform - Transform to apply to the bounds
+	// @returns Rectangle bounding clipping rectangles of all draw commands in this list
+	FSlateRect GetClippingBounds(const FTransform2D& Transform) const;
+
+	// Calculate a hash of commands, vertices, indices and revisions of textures used in this list. Lists with the same hash
+	// produce the same output.
+	// @param TextureManager - Texture manager used to find revisions of textures
+	// @returns Hash of the list content
+	uint64 GetContentHash(const FTextureManager& TextureManager) const;
+
 	// Get the draw command by number.
 	// @param CommandNb - Number of draw command
 	// @param Transform - Transform to apply to clipping rectangle
@@ -72,6 +108,32 @@ public:
 	void CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform) const;
 #endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	// Transform and append a range of vertex data to target buffer.
+	// @param OutVertexBuffer - Destination buffer
+	// @param FirstVertex - Index of the first vertex to append
+	// @param NumVertices - How many vertices we want to append
+	// @param Transform - Transform to apply to appended vertices
+	// @param VertexClippingRect - Clipping rectangle for transformed Slate vertices
+	void AppendVertexData(TArray<FSlateVertex>& OutVertexBuffer, int32 FirstVertex, int32 NumVertices, const FTransform2D& Transform,
+		const FSlateRotatedRect& VertexClippingRect) const;
+#else
+	// Transform and append a range of vertex data to target buffer.
+	// @param OutVertexBuffer - Destination buffer
+	// @param FirstVertex - Index of the first vertex to append
+	// @param NumVertices - How many vertices we want to append
+	// @param Transform - Transform to apply to appended vertices
+	void AppendVertexData(TArray<FSlateVertex>& OutVertexBuffer, int32 FirstVertex, int32 NumVertices, const FTransform2D& Transform) const;
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+	// Append a range of index data to target buffer, offsetting every index by the same value. This allows to move
+	// indices to vertices appended to a different position in the target vertex buffer.
+	// @param OutIndexBuffer - Destination buffer
+	// @param StartIndex - Start appending source data starting from this index
+	// @param NumElements - How many elements we want to append
+	// @param IndexOffset - Value added to every appended index
+	void AppendIndexData(TArray<SlateIndex>& OutIndexBuffer, int32 StartIndex, int32 NumElements, int32 IndexOffset) const;
+
 	// Transform and copy index data to target buffer (old data in the target buffer are replaced).
 	// Internal index buffer contains enough data to match the sum of NumElements from all draw commands.
 	// @param OutIndexBuffer - Destination buffer
@@ -79,12 +141,142 @@ public:
 	// @param NumElements - How many elements we want to copy
 	void CopyIndexData(TArray<SlateIndex>& OutIndexBuffer, const int32 StartIndex, const int32 NumElements) const;
 
-	// Transfers data from ImGui source list to this object. Leaves source cleared.
-	void TransferDrawData(ImDrawList& Src);
+	// Append vertex and index data to target buffers, keeping them in ImGui format.
+	// @param OutVertexBuffer - Destination vertex buffer
+	// @param OutIndexBuffer - Destination index buffer
+	void AppendGeometry(TArray<ImDrawVert>& OutVertexBuffer, TArray<ImDrawIdx>& OutIndexBuffer) const;
+
+	// Replace texture indices in all draw commands.
+	// @param Remap - Function mapping texture indices used in this list to new indices
+	void RemapTextures(TFunctionRef<TextureIndex(TextureIndex)> Remap);
+
+	// Append raw data of this list to a buffer. Commands are stored with texture indices, vertex and index data are
+	// stored in ImGui format.
+	// @param OutBuffer - Destination buffer
+	void WriteRawData(TArray<uint8>& OutBuffer) const;
+
+	// Replace data in this list with raw data written by WriteRawData.
+	// @param Data - Pointer to raw data, advanced past data read by this call
+	// @param DataEnd - End of the raw data buffer
+	// @returns True, if complete list data were read
+	bool ReadRawData(const uint8*& Data, const uint8* DataEnd);
+
+private:
+
+	friend class FImGuiDrawBatches;
+	friend class FImGuiDrawDataArena;
+
+	// Point views to buffers owned by this list.
+	void BindStorage();
+
+	// Data of this list, stored either in the buffers below or in an arena.
+	TImGuiDrawDataView<ImDrawCmd> ImGuiCommandBuffer;
+	TImGuiDrawDataView<ImDrawIdx> ImGuiIndexBuffer;
+	TImGuiDrawDataView<ImDrawVert> ImGuiVertexBuffer;
+
+	// Buffers owned by this list. They are not released when the list is bound to an arena, so they can be reused.
+	ImVector<ImDrawCmd> CommandStorage;
+	ImVector<ImDrawIdx> IndexStorage;
+	ImVector<ImDrawVert> VertexStorage;
+};
+
+// Offsets of draw list data in a draw data arena.
+struct FImGuiDrawListOffsets
+{
+	int32 Commands;
+	int32 Indices;
+	int32 Vertices;
+	int32 NumCommands;
+	int32 NumIndices;
+	int32 NumVertices;
+};
+
+// Draw data of one frame packed into one contiguous, cache line aligned block of memory. Commands, indices and vertices
+// of every list are stored in separate aligned blocks, one list after another, so converting a frame walks memory
+// sequentially and the whole frame can be uploaded at once. Index offsets of packed commands are updated to match the
+// layout of their lists.
+// Arena is not shrunk, so after a few frames it is sized to the high-water mark and packing doesn't allocate.
+class FImGuiDrawDataArena
+{
+public:
+
+	// Alignment of the arena and of every block in it (one cache line).
+	static constexpr int32 Alignment = 64;
+
+	// Pack ImGui draw data and bind draw lists to packed data. Draw lists array is resized to match draw data.
+	// @param DrawData - ImGui draw data to pack
+	// @param DrawLists - Draw lists to bind
+	void Pack(const ImDrawData& DrawData, TArray<FImGuiDrawList>& DrawLists);
+
+	// Pack data of draw lists and bind lists to packed data. Lists must not reference this arena.
+	// @param DrawLists - Draw lists to pack and bind
+	void Pack(TArray<FImGuiDrawList>& DrawLists);
+
+	// Get packed data.
+	const uint8* GetData() const { return Buffer.GetData(); }
+
+	// Get the size of packed data in bytes.
+	int32 GetSize() const { return Buffer.Num(); }
+
+	// Get the size of the arena allocation in bytes.
+	int32 GetCapacity() const { return Buffer.Max(); }
+
+	// Get offsets of data of every packed draw list.
+	const TArray<FImGuiDrawListOffsets>& GetOffsets() const { return Offsets; }
+
+private:
+
+	template<typename TSourceFunc>
+	void PackLists(int32 NumLists, TSourceFunc GetSource, TArray<FImGuiDrawList>& DrawLists);
+
+	TArray<uint8, TAlignedHeapAllocator<Alignment>> Buffer;
+	TArray<FImGuiDrawListOffsets> Offsets;
+};
+
+// Draw command included in a batch, with ranges of indices and vertices that it uses in its draw list.
+struct FImGuiBatchedCommand
+{
+	int32 DrawListIndex;
+	int32 CommandIndex;
+	int32 StartIndex;
+	int32 NumIndices;
+	int32 FirstVertex;
+	int32 NumVertices;
+};
+
+// Consecutive draw commands, possibly from different draw lists, that use the same texture and can be drawn with one
+// clipping rectangle.
+struct FImGuiDrawBatch
+{
+	// Clipping rectangle in ImGui space.
+	FSlateRect ClippingRect;
+	TextureIndex TextureId;
+	int32 FirstCommand;
+	int32 NumCommands;
+};
+
+// Merges draw commands from all draw lists into batches that can be drawn as single elements. ImGui creates a separate
+// draw list for every window, so without batching even a few small windows using only the font texture need many
+// draw calls. Commands are merged only with their neighbours in painter's order, so drawing batches one by one gives
+// the same output as drawing lists one by one.
+// Commands with different clipping rectangles are merged only if their geometry is inside of their own clipping
+// rectangles, in which case the union of those rectangles clips nothing that would be visible otherwise.
+class FImGuiDrawBatches
+{
+public:
+
+	// Rebuild batches for draw lists. Previous batches are discarded, but allocations are kept.
+	// @param DrawLists - Draw lists to batch
+	void Build(const TArray<FImGuiDrawList>& DrawLists);
+
+	// Get batches in painter's order.
+	const TArray<FImGuiDrawBatch>& GetBatches() const { return Batches; }
+
+	// Get commands referenced by batches (each batch references a continuous range).
+	const TArray<FImGuiBatchedCommand>& GetCommands() const { return Commands; }
 
 private:
 
-	ImVector<ImDrawCmd> ImGuiCommandBuffer;
-	ImVector<ImDrawIdx> ImGuiIndexBuffer;
-	ImVector<ImDrawVert> ImGuiVertexBuffer;
+	TArray<FImGuiDrawBatch> Batches;
+	TArray<FImGuiBatchedCommand> Commands;
 };
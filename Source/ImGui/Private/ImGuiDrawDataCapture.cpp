@@ -0,0 +1,351 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ImGuiDrawDataCapture.h"
+
+#include "ImGuiModuleDebug.h"
+
+#include <HAL/FileManager.h>
+#include <Misc/Compression.h>
+#include <Misc/FileHelper.h>
+
+
+DEFINE_LOG_CATEGORY(LogImGuiCapture);
+
+namespace
+{
+	constexpr uint32 CaptureMagic = 0x43444749; // "IGDC"
+	constexpr uint32 CaptureVersion = 1;
+
+	// Every n-th frame is encoded without delta.
+	constexpr int32 KeyFrameInterval = 120;
+
+	enum ERecordFlags : uint32
+	{
+		RecordFlag_Delta = 1 << 0,
+		RecordFlag_Compressed = 1 << 1,
+	};
+
+	struct FCaptureHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 VertexSize;
+		uint32 IndexSize;
+	};
+
+	struct FRecordHeader
+	{
+		uint32 RawSize;
+		uint32 EncodedSize;
+		uint32 Flags;
+	};
+
+	// XOR destination with source in the range in which both buffers overlap.
+	void XorBuffers(TArray<uint8>& Dst, const TArray<uint8>& Src)
+	{
+		const int32 Num = FMath::Min(Dst.Num(), Src.Num());
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			Dst[Index] ^= Src[Index];
+		}
+	}
+
+	void AppendBytes(TArray<uint8>& OutBuffer, const void* Data, int32 Size)
+	{
+		OutBuffer.Append(static_cast<const uint8*>(Data), Size);
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// Encoder
+//----------------------------------------------------------------------------------------------------
+
+void FImGuiDrawDataEncoder::Encode(const TArray<FImGuiDrawList>& DrawLists, TArray<uint8>& OutRecord)
+{
+	FrameData.Reset();
+
+	const int32 NumDrawLists = DrawLists.Num();
+	AppendBytes(FrameData, &NumDrawLists, sizeof(NumDrawLists));
+	for (const FImGuiDrawList& DrawList : DrawLists)
+	{
+		DrawList.WriteRawData(FrameData);
+	}
+
+	FRecordHeader Header{ static_cast<uint32>(FrameData.Num()), 0, 0 };
+
+	// Delta encode against the previous frame, so unchanged bytes become zeros.
+	const TArray<uint8>* Source = &FrameData;
+	if (FramesSinceKeyFrame >= 0 && FramesSinceKeyFrame + 1 < KeyFrameInterval)
+	{
+		DeltaData = FrameData;
+		XorBuffers(DeltaData, PreviousFrameData);
+		Source = &DeltaData;
+		Header.Flags |= RecordFlag_Delta;
+		FramesSinceKeyFrame++;
+	}
+	else
+	{
+		FramesSinceKeyFrame = 0;
+	}
+
+	// Compress if that makes data smaller, otherwise store them as they are.
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Source->Num());
+	CompressedData.SetNumUninitialized(CompressedSize);
+	if (FCompression::CompressMemory(NAME_Zlib, CompressedData.GetData(), CompressedSize, Source->GetData(), Source->Num())
+		&& CompressedSize < Source->Num())
+	{
+		Header.EncodedSize = CompressedSize;
+		Header.Flags |= RecordFlag_Compressed;
+		AppendBytes(OutRecord, &Header, sizeof(Header));
+		AppendBytes(OutRecord, CompressedData.GetData(), CompressedSize);
+	}
+	else
+	{
+		Header.EncodedSize = Source->Num();
+		AppendBytes(OutRecord, &Header, sizeof(Header));
+		AppendBytes(OutRecord, Source->GetData(), Source->Num());
+	}
+
+	Swap(FrameData, PreviousFrameData);
+	RawBytes += Header.RawSize;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Decoder
+//----------------------------------------------------------------------------------------------------
+
+int64 FImGuiDrawDataDecoder::GetRecordSize(const uint8* Data, int64 Size)
+{
+	if (Size < static_cast<int64>(sizeof(FRecordHeader)))
+	{
+		return INDEX_NONE;
+	}
+
+	FRecordHeader Header;
+	FMemory::Memcpy(&Header, Data, sizeof(Header));
+
+	const int64 RecordSize = sizeof(Header) + static_cast<int64>(Header.EncodedSize);
+	return (RecordSize <= Size) ? RecordSize : INDEX_NONE;
+}
+
+bool FImGuiDrawDataDecoder::Decode(const uint8* Record, int64 RecordSize, TArray<FImGuiDrawList>& OutDrawLists)
+{
+	// After a failure, the base for delta records is out of sync with the encoder until the next key frame.
+	bNeedsKeyFrame = !DecodeRecord(Record, RecordSize, OutDrawLists);
+	return !bNeedsKeyFrame;
+}
+
+bool FImGuiDrawDataDecoder::DecodeRecord(const uint8* Record, int64 RecordSize, TArray<FImGuiDrawList>& OutDrawLists)
+{
+	if (GetRecordSize(Record, RecordSize) != RecordSize)
+	{
+		return false;
+	}
+
+	FRecordHeader Header;
+	FMemory::Memcpy(&Header, Record, sizeof(Header));
+	const uint8* Payload = Record + sizeof(Header);
+
+	// Limit allocation for corrupted or malicious records. Delta records can't be decoded without a valid base.
+	if (Header.RawSize > MaxRawRecordSize || ((Header.Flags & RecordFlag_Delta) && bNeedsKeyFrame))
+	{
+		return false;
+	}
+
+	FrameData.SetNumUninitialized(static_cast<int32>(Header.RawSize));
+	if (Header.Flags & RecordFlag_Compressed)
+	{
+		if (!FCompression::UncompressMemory(NAME_Zlib, FrameData.GetData(), Header.RawSize, Payload, Header.EncodedSize))
+		{
+			return false;
+		}
+	}
+	else if (Header.EncodedSize == Header.RawSize)
+	{
+		FMemory::Memcpy(FrameData.GetData(), Payload, Header.RawSize);
+	}
+	else
+	{
+		return false;
+	}
+
+	if (Header.Flags & RecordFlag_Delta)
+	{
+		XorBuffers(FrameData, PreviousFrameData);
+	}
+
+	const uint8* Data = FrameData.GetData();
+	const uint8* DataEnd = Data + FrameData.Num();
+
+	int32 NumDrawLists = 0;
+	if (FrameData.Num() < static_cast<int32>(sizeof(NumDrawLists)))
+	{
+		return false;
+	}
+	FMemory::Memcpy(&NumDrawLists, Data, sizeof(NumDrawLists));
+	Data += sizeof(NumDrawLists);
+
+	// Every list needs at least its counts, which also limits the number of lists to allocate.
+	if (NumDrawLists < 0 || static_cast<int64>(NumDrawLists) * 3 * static_cast<int64>(sizeof(int32)) > static_cast<int64>(DataEnd - Data))
+	{
+		return false;
+	}
+
+	// Decode to separate lists, so output is only replaced if the whole frame is valid.
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4)
+	DecodedDrawLists.SetNum(NumDrawLists, EAllowShrinking::No);
+#else
+	DecodedDrawLists.SetNum(NumDrawLists, false);
+#endif
+	for (FImGuiDrawList& DrawList : DecodedDrawLists)
+	{
+		if (!DrawList.ReadRawData(Data, DataEnd))
+		{
+			return false;
+		}
+	}
+
+	// Whole frame is valid, so it can replace the output and become a base for the next delta record.
+	Swap(FrameData, PreviousFrameData);
+	Swap(OutDrawLists, DecodedDrawLists);
+	return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Capture
+//----------------------------------------------------------------------------------------------------
+
+TUniquePtr<FImGuiDrawDataCapture> FImGuiDrawDataCapture::Create(const FString& Filename)
+{
+	FArchive* Writer = IFileManager::Get().CreateFileWriter(*Filename);
+	if (!Writer)
+	{
+		UE_LOG(LogImGuiCapture, Error, TEXT("Couldn't open capture file '%s' for writing."), *Filename);
+		return nullptr;
+	}
+
+	FCaptureHeader Header{ CaptureMagic, CaptureVersion, sizeof(ImDrawVert), sizeof(ImDrawIdx) };
+	Writer->Serialize(&Header, sizeof(Header));
+
+	return TUniquePtr<FImGuiDrawDataCapture>(new FImGuiDrawDataCapture(Filename, Writer));
+}
+
+FImGuiDrawDataCapture::FImGuiDrawDataCapture(const FString& InFilename, FArchive* InWriter)
+	: Filename(InFilename)
+	, Writer(InWriter)
+	, WrittenBytes(sizeof(FCaptureHeader))
+{
+}
+
+FImGuiDrawDataCapture::~FImGuiDrawDataCapture()
+{
+	Writer->Close();
+
+	UE_LOG(LogImGuiCapture, Log, TEXT("Captured %d frames to '%s' (%lld KB of draw data written as %lld KB)."),
+		NumFrames, *Filename, GetRawBytes() / 1024, WrittenBytes / 1024);
+}
+
+void FImGuiDrawDataCapture::AddFrame(const TArray<FImGuiDrawList>& DrawLists)
+{
+	Record.Reset();
+	Encoder.Encode(DrawLists, Record);
+	Writer->Serialize(Record.GetData(), Record.Num());
+
+	NumFrames++;
+	WrittenBytes += Record.Num();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Replay
+//----------------------------------------------------------------------------------------------------
+
+TSharedPtr<FImGuiDrawDataReplay> FImGuiDrawDataReplay::Create(const FString& Filename)
+{
+	TSharedPtr<FImGuiDrawDataReplay> Replay = MakeShareable(new FImGuiDrawDataReplay(Filename));
+	if (!FFileHelper::LoadFileToArray(Replay->FileData, *Filename))
+	{
+		UE_LOG(LogImGuiCapture, Error, TEXT("Couldn't load capture file '%s'."), *Filename);
+		return nullptr;
+	}
+
+	const TArray<uint8>& FileData = Replay->FileData;
+
+	FCaptureHeader Header;
+	if (FileData.Num() < static_cast<int32>(sizeof(Header)))
+	{
+		UE_LOG(LogImGuiCapture, Error, TEXT("'%s' is not a valid capture file."), *Filename);
+		return nullptr;
+	}
+
+	FMemory::Memcpy(&Header, FileData.GetData(), sizeof(Header));
+	if (Header.Magic != CaptureMagic || Header.Version != CaptureVersion
+		|| Header.VertexSize != sizeof(ImDrawVert) || Header.IndexSize != sizeof(ImDrawIdx))
+	{
+		UE_LOG(LogImGuiCapture, Error, TEXT("'%s' is not a valid capture file or it was written in incompatible format."), *Filename);
+		return nullptr;
+	}
+
+	// Index records, dropping incomplete data at the end (e.g. if game stopped during capture).
+	int64 Offset = sizeof(Header);
+	int64 RecordSize;
+	while ((RecordSize = FImGuiDrawDataDecoder::GetRecordSize(FileData.GetData() + Offset, FileData.Num() - Offset)) != INDEX_NONE)
+	{
+		Replay->RecordOffsets.Add(Offset);
+		Offset += RecordSize;
+	}
+
+	if (Replay->RecordOffsets.Num() == 0)
+	{
+		UE_LOG(LogImGuiCapture, Error, TEXT("Capture file '%s' has no frames."), *Filename);
+		return nullptr;
+	}
+
+	return Replay;
+}
+
+bool FImGuiDrawDataReplay::ReadFrame(TArray<FImGuiDrawList>& OutDrawLists)
+{
+	// Loop back to the first record, which is always a key frame.
+	if (NextFrame >= RecordOffsets.Num())
+	{
+		NextFrame = 0;
+	}
+
+	const int32 FrameNb = NextFrame++;
+	const int64 Offset = RecordOffsets[FrameNb];
+	const int64 RecordSize = FImGuiDrawDataDecoder::GetRecordSize(FileData.GetData() + Offset, FileData.Num() - Offset);
+	const bool bWasInSync = !Decoder.NeedsKeyFrame() || FrameNb == 0;
+	if (!Decoder.Decode(FileData.GetData() + Offset, RecordSize, OutDrawLists))
+	{
+		// Log only the first failure, as delta frames that follow are rejected until the next key frame.
+		if (bWasInSync)
+		{
+			UE_LOG(LogImGuiCapture, Error, TEXT("Failed to decode frame %d in '%s'. Frames will be skipped until the next key frame."), FrameNb, *Filename);
+		}
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,191 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "ImGuiDrawData.h"
+
+#include <Templates/UniquePtr.h>
+
+
+class FArchive;
+
+// Source of draw data that can replace the output of a context (see FImGuiContextProxy::SetDrawDataSource).
+class IImGuiDrawDataSource
+{
+public:
+
+	virtual ~IImGuiDrawDataSource() = default;
+
+	// Read the next frame.
+	// @param OutDrawLists - Draw lists that should be replaced with data from the next frame
+	// @returns True, if draw lists were updated
+	virtual bool ReadFrame(TArray<FImGuiDrawList>& OutDrawLists) = 0;
+};
+
+// Encodes draw data of consecutive frames to compact records.
+//
+// Each record contains raw draw lists (see FImGuiDrawList::WriteRawData), which are XOR-ed with the previous frame
+// (except for key frames) and compressed. Layout of draw data is usually stable between frames, so delta encoding
+// produces mostly zeros and compresses well.
+class FImGuiDrawDataEncoder
+{
+public:
+
+	// Encode draw data of a single frame.
+	// @param DrawLists - Draw lists to encode
+	// @param OutRecord - Buffer to which the encoded record is appended
+	void Encode(const TArray<FImGuiDrawList>& DrawLists, TArray<uint8>& OutRecord);
+
+	// Make the next record a key frame, which can be decoded without previous records (e.g. after records were lost).
+	void ForceKeyFrame() { FramesSinceKeyFrame = -1; }
+
+	// Get the number of bytes of draw data before encoding.
+	int64 GetRawBytes() const { return RawBytes; }
+
+private:
+
+	TArray<uint8> FrameData;
+	TArray<uint8> PreviousFrameData;
+	TArray<uint8> DeltaData;
+	TArray<uint8> CompressedData;
+
+	int32 FramesSinceKeyFrame = -1;
+	int64 RawBytes = 0;
+};
+
+// Decodes records written by FImGuiDrawDataEncoder. Records need to be decoded in the same order in which they were
+// encoded, starting from a key frame.
+class FImGuiDrawDataDecoder
+{
+public:
+
+	// Get the size of a record.
+	// @param Data - Data starting with a record
+	// @param Size - Number of bytes available in data
+	// @returns Size of the record or INDEX_NONE, if data don't contain a complete record
+	static int64 GetRecordSize(const uint8* Data, int64 Size);
+
+	// Decode a single record.
+	// @param Record - Record data
+	// @param RecordSize - Size of the record
+	// @param OutDrawLists - Draw lists that will be replaced with decoded data, left unchanged if decoding fails
+	// @returns True, if record was successfully decoded, otherwise the decoder needs a key frame
+	bool Decode(const uint8* Record, int64 RecordSize, TArray<FImGuiDrawList>& OutDrawLists);
+
+	// Whether the decoder needs a key frame, because no record was decoded yet or the last record failed to decode.
+	// Delta records are rejected until a key frame is successfully decoded.
+	bool NeedsKeyFrame() const { return bNeedsKeyFrame; }
+
+private:
+
+	bool DecodeRecord(const uint8* Record, int64 RecordSize, TArray<FImGuiDrawList>& OutDrawLists);
+
+	// Records with bigger decoded size are rejected.
+	static constexpr uint32 MaxRawRecordSize = 256 * 1024 * 1024;
+
+	TArray<uint8> FrameData;
+	TArray<uint8> PreviousFrameData;
+	TArray<FImGuiDrawList> DecodedDrawLists;
+
+	bool bNeedsKeyFrame = true;
+};
+
+// Writes draw data of consecutive frames to a binary capture file, so ImGui output of real scenes can be replayed and
+// profiled later. File starts with a header followed by records written by FImGuiDrawDataEncoder.
+class FImGuiDrawDataCapture
+{
+public:
+
+	// Create capture writing to the given file.
+	// @param Filename - Path to the capture file
+	// @returns Capture object or null, if file couldn't be opened
+	static TUniquePtr<FImGuiDrawDataCapture> Create(const FString& Filename);
+
+	~FImGuiDrawDataCapture();
+
+	// Write draw data of a single frame.
+	void AddFrame(const TArray<FImGuiDrawList>& DrawLists);
+
+	// Get the path to the capture file.
+	const FString& GetFilename() const { return Filename; }
+
+	// Get the number of captured frames.
+	int32 GetNumFrames() const { return NumFrames; }
+
+	// Get the number of bytes of draw data before encoding.
+	int64 GetRawBytes() const { return Encoder.GetRawBytes(); }
+
+	// Get the number of bytes written to the file.
+	int64 GetWrittenBytes() const { return WrittenBytes; }
+
+private:
+
+	FImGuiDrawDataCapture(const FString& InFilename, FArchive* InWriter);
+
+	FString Filename;
+	TUniquePtr<FArchive> Writer;
+
+	FImGuiDrawDataEncoder Encoder;
+	TArray<uint8> Record;
+
+	int32 NumFrames = 0;
+	int64 WrittenBytes = 0;
+};
+
+// Reads draw data from a capture file written by FImGuiDrawDataCapture. Frames are read sequentially and the replay
+// loops back to the first frame after reaching the end of the capture.
+class FImGuiDrawDataReplay : public IImGuiDrawDataSource
+{
+public:
+
+	// Load a capture file.
+	// @param Filename - Path to the capture file
+	// @returns Replay object or null, if file couldn't be loaded or is not a valid capture
+	static TSharedPtr<FImGuiDrawDataReplay> Create(const FString& Filename);
+
+	virtual bool ReadFrame(TArray<FImGuiDrawList>& OutDrawLists) override;
+
+	// Get the path to the capture file.
+	const FString& GetFilename() const { return Filename; }
+
+	// Get the number of frames in the capture.
+	int32 GetNumFrames() const { return RecordOffsets.Num(); }
+
+	// Get the number of the frame that will be read next.
+	int32 GetNextFrame() const { return NextFrame; }
+
+private:
+
+	FImGuiDrawDataReplay(const FString& InFilename) : Filename(InFilename) {}
+
+	FString Filename;
+
+	TArray<uint8> FileData;
+	TArray<int64> RecordOffsets;
+
+	FImGuiDrawDataDecoder Decoder;
+
+	int32 NextFrame = 0;
+};
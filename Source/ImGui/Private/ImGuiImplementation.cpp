@@ -43,20 +43,116 @@
 #include <Windows/AllowWindowsPlatformTypes.h>
 #endif // PLATFORM_WINDOWS
 
+#if WITH_EDITOR
+// Current context is set through a handle that copies it to other instances of this module (see below). ImGui reads
+// the global context pointer (GImGui) of its own instance directly, so reads cost the same as in game builds.
+static void SetCurrentContextInAllModules(ImGuiContext* Context);
+#define IMGUI_SET_CURRENT_CONTEXT_FUNC(Context) SetCurrentContextInAllModules(Context)
+#endif // WITH_EDITOR
+
+#include "imgui.cpp"
+#include "imgui_demo.cpp"
+#include "imgui_draw.cpp"
+#include "imgui_widgets.cpp"
+
+#include "imgui_tables.cpp"
+
 #if WITH_EDITOR
 
 #include "ImGuiModule.h"
 #include "Utilities/RedirectingHandle.h"
 
 // Redirecting handle which will automatically bind to another one, if a different instance of the module is loaded.
-struct FImGuiContextHandle : public Utilities::TRedirectingHandle<ImGuiContext*>
+// Handles share the context pointer of the root instance, but every instance also keeps its own global context pointer
+// (GImGui or GImPlot) up to date, so after hot-reload functions statically bound to obsolete instances still use the
+// current context.
+template<typename ContextType, ContextType*& CurrentContext>
+struct TContextHandle : public Utilities::TRedirectingHandle<ContextType*>
+{
+	using Super = Utilities::TRedirectingHandle<ContextType*>;
+
+	TContextHandle(ContextType*& InDefaultContext)
+		: Super(InDefaultContext)
+		// Non-virtual functions run the code of the calling module, so propagation is dispatched through a pointer
+		// bound here, to make sure that it always updates the context in the module instance owning this handle.
+		, PropagateContextFunc([](TContextHandle& Handle, ContextType* Context) { Handle.PropagateContext(Context); })
+	{
+	}
+
+	~TContextHandle()
+	{
+		if (this->Parent)
+		{
+			static_cast<TContextHandle*>(this->Parent)->OnContextChanged.RemoveAll(this);
+		}
+	}
+
+	// Set the other handle as a parent to this one and start following its context changes.
+	void SetParentHandle(TContextHandle* InParent)
+	{
+		if (this->Parent)
+		{
+			static_cast<TContextHandle*>(this->Parent)->OnContextChanged.RemoveAll(this);
+		}
+
+		this->SetParent(InParent);
+
+		if (this->Parent)
+		{
+			static_cast<TContextHandle*>(this->Parent)->OnContextChanged.AddRaw(this, &TContextHandle::UpdateContext);
+			UpdateContext(this->Get());
+		}
+	}
+
+	// Set the current context in this and all linked module instances.
+	void SetCurrentContext(ContextType* Context)
+	{
+		this->Get() = Context;
+
+		// Propagate from the root, so all instances are updated. Limited depth protects from cycles, which can be
+		// created when modules are swapped during hot-reload.
+		TContextHandle* Root = this;
+		for (int32 Depth = 0; Depth < 16 && Root->Parent && Root->Parent != this; Depth++)
+		{
+			Root = static_cast<TContextHandle*>(Root->Parent);
+		}
+
+		Root->PropagateContextFunc(*Root, Context);
+	}
+
+private:
+
+	void PropagateContext(ContextType* Context)
+	{
+		CurrentContext = Context;
+		OnContextChanged.Broadcast(Context);
+	}
+
+	void UpdateContext(ContextType* Context)
+	{
+		// Only forward changes, so propagation stops after visiting every handle once (even with cycles).
+		if (CurrentContext != Context)
+		{
+			PropagateContext(Context);
+		}
+	}
+
+	// Propagation function bound in the module instance owning this handle.
+	void (*PropagateContextFunc)(TContextHandle&, ContextType*);
+
+	// Event with a new context, broadcast to handles in other module instances.
+	DECLARE_MULTICAST_DELEGATE_OneParam(FContextChangedDelegate, ContextType*);
+	FContextChangedDelegate OnContextChanged;
+};
+
+struct FImGuiContextHandle : public TContextHandle<ImGuiContext, GImGui>
 {
 	FImGuiContextHandle(ImGuiContext*& InDefaultContext)
-		: Utilities::TRedirectingHandle<ImGuiContext*>(InDefaultContext)
+		: TContextHandle<ImGuiContext, GImGui>(InDefaultContext)
 	{
 		if (FImGuiModule* Module = FModuleManager::GetModulePtr<FImGuiModule>("ImGui"))
 		{
-			SetParent(Module->ImGuiContextHandle);
+			SetParentHandle(Module->ImGuiContextHandle);
 		}
 	}
 };
@@ -64,16 +160,54 @@ struct FImGuiContextHandle : public Utilities::TRedirectingHandle<ImGuiContext*>
 static ImGuiContext* ImGuiContextPtr = nullptr;
 static FImGuiContextHandle ImGuiContextPtrHandle(ImGuiContextPtr);
 
-// Get the global ImGui context pointer (GImGui) indirectly to allow redirections in obsolete modules.
-#define GImGui (ImGuiContextPtrHandle.Get())
+static void SetCurrentContextInAllModules(ImGuiContext* Context)
+{
+	ImGuiContextPtrHandle.SetCurrentContext(Context);
+}
+
+// ImPlot context is propagated in the same way as the ImGui context (see below).
+struct ImPlotContext;
+static void SetCurrentPlotContextInAllModules(ImPlotContext* Context);
+#define IMPLOT_SET_CURRENT_CONTEXT_FUNC(Context) SetCurrentPlotContextInAllModules(Context)
+
 #endif // WITH_EDITOR
 
-#include "imgui.cpp"
-#include "imgui_demo.cpp"
-#include "imgui_draw.cpp"
-#include "imgui_widgets.cpp"
+// ImPlot is built in the same way, so it shares the ImGui context pointer defined above. Warnings are handled as in
+// other third party code. Jobs that ImPlot can run in parallel (e.g. histogram binning) use the task graph.
+#include <Async/ParallelFor.h>
+#define IMPLOT_PARALLEL_FOR(Count, Func) ParallelFor((Count), (Func))
 
-#include "imgui_tables.cpp"
+THIRD_PARTY_INCLUDES_START
+#include "implot.cpp"
+#include "implot_items.cpp"
+#include "implot_demo.cpp"
+THIRD_PARTY_INCLUDES_END
+
+// Don't leak macros from the ImPlot demo to the rest of this file.
+#undef sprintf
+#undef CHECKBOX_FLAG
+
+#if WITH_EDITOR
+struct FImPlotContextHandle : public TContextHandle<ImPlotContext, GImPlot>
+{
+	FImPlotContextHandle(ImPlotContext*& InDefaultContext)
+		: TContextHandle<ImPlotContext, GImPlot>(InDefaultContext)
+	{
+		if (FImGuiModule* Module = FModuleManager::GetModulePtr<FImGuiModule>("ImGui"))
+		{
+			SetParentHandle(Module->ImPlotContextHandle);
+		}
+	}
+};
+
+static ImPlotContext* ImPlotContextPtr = nullptr;
+static FImPlotContextHandle ImPlotContextPtrHandle(ImPlotContextPtr);
+
+static void SetCurrentPlotContextInAllModules(ImPlotContext* Context)
+{
+	ImPlotContextPtrHandle.SetCurrentContext(Context);
+}
+#endif // WITH_EDITOR
 
 #if PLATFORM_WINDOWS
 #include <Windows/HideWindowsPlatformTypes.h>
@@ -92,7 +226,17 @@ namespace ImGuiImplementation
 
 	void SetParentContextHandle(FImGuiContextHandle& Parent)
 	{
-		ImGuiContextPtrHandle.SetParent(&Parent);
+		ImGuiContextPtrHandle.SetParentHandle(&Parent);
+	}
+
+	FImPlotContextHandle& GetPlotContextHandle()
+	{
+		return ImPlotContextPtrHandle;
+	}
+
+	void SetParentPlotContextHandle(FImPlotContextHandle& Parent)
+	{
+		ImPlotContextPtrHandle.SetParentHandle(&Parent);
 	}
 #endif // WITH_EDITOR
 }
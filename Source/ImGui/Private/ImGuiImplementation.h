@@ -25,6 +25,7 @@
 #pragma once
 
 struct FImGuiContextHandle;
+struct FImPlotContextHandle;
 
 // Gives access to selected ImGui implementation features.
 namespace ImGuiImplementation
@@ -35,5 +36,11 @@ namespace ImGuiImplementation
 
 	// Set the ImGui Context pointer handle.
 	void SetParentContextHandle(FImGuiContextHandle& Parent);
+
+	// Get the handle to the ImPlot Context pointer.
+	FImPlotContextHandle& GetPlotContextHandle();
+
+	// Set the ImPlot Context pointer handle.
+	void SetParentPlotContextHandle(FImPlotContextHandle& Parent);
 #endif // WITH_EDITOR
 }
@@ -24,6 +24,8 @@
 
 #include "ImGuiInputState.h"
 
+#include <imgui_internal.h>
+
 #include <algorithm>
 #include <limits>
 #include <type_traits>
@@ -39,6 +41,11 @@ void FImGuiInputState::AddCharacter(TCHAR Char)
 	imguiIO->AddInputCharacter(ImGuiInterops::CastInputChar(Char));
 }
 
+void FImGuiInputState::AddCharacterCode(uint32 CodePoint)
+{
+	imguiIO->AddInputCharacter(CodePoint);
+}
+
 void FImGuiInputState::SetKeyDown(const FKeyEvent& KeyEvent, bool bIsDown)
 {
 	const FKey& Key = KeyEvent.GetKey();
@@ -47,8 +54,12 @@ void FImGuiInputState::SetKeyDown(const FKeyEvent& KeyEvent, bool bIsDown)
 
 void FImGuiInputState::SetKeyDown(const FKey& Key, bool bIsDown)
 {
-	const ImGuiKey imKey = ImGuiInterops::GetImGuiKey(Key);
-	imguiIO->AddKeyEvent(imKey, bIsDown);
+	SetKeyDown(ImGuiInterops::GetImGuiKey(Key), bIsDown, bIsDown ? 1.f : 0.f);
+}
+
+void FImGuiInputState::SetKeyDown(ImGuiKey imKey, bool bIsDown, float AnalogValue)
+{
+	imguiIO->AddKeyAnalogEvent(imKey, bIsDown, AnalogValue);
 
 	bIsLeftControlDown = imKey == ImGuiKey_LeftCtrl && bIsDown;
 	bIsRightControlDown = imKey == ImGuiKey_RightCtrl && bIsDown;
@@ -79,12 +90,23 @@ void FImGuiInputState::SetMouseDown(const FKey& MouseButton, bool bIsDown)
 	imguiIO->AddMouseButtonEvent(mouseIndex, bIsDown);	
 }
 
+void FImGuiInputState::SetMouseDown(int32 MouseButton, bool bIsDown)
+{
+	imguiIO->AddMouseButtonEvent(MouseButton, bIsDown);
+}
+
 void FImGuiInputState::AddMouseWheelDelta(float DeltaValue)
 {
 	imguiIO->AddMouseWheelEvent(0, DeltaValue);
 	MouseWheelDelta += DeltaValue;
 }
 
+void FImGuiInputState::AddMouseWheelDelta(float DeltaX, float DeltaY)
+{
+	imguiIO->AddMouseWheelEvent(DeltaX, DeltaY);
+	MouseWheelDelta += DeltaY;
+}
+
 void FImGuiInputState::SetMousePosition(const FVector2D& Position)
 {
 	imguiIO->AddMousePosEvent(Position.X, Position.Y);
@@ -108,6 +130,11 @@ void FImGuiInputState::SetTouchPosition(const FVector2D& Position)
 	imguiIO->AddMousePosEvent(Position.X, Position.Y);
 }
 
+void FImGuiInputState::SetFocus(bool bHasFocus)
+{
+	imguiIO->AddFocusEvent(bHasFocus);
+}
+
 void FImGuiInputState::SetGamepadNavigationAxis(const FAnalogInputEvent& AnalogInputEvent, float Value)
 {
 	if(!AnalogInputEvent.GetKey().IsGamepadKey())
@@ -152,6 +179,19 @@ void FImGuiInputState::SetGamepad(bool bInHasGamepad)
 	bHasGamepad = bInHasGamepad;	
 }
 
+void FImGuiInputState::ConsumeQueuedEvents(TFunctionRef<void(const ImGuiInputEvent&)> Visitor)
+{
+	if (imguiIO)
+	{
+		ImVector<ImGuiInputEvent>& Events = imguiIO->Ctx->InputEventsQueue;
+		for (const ImGuiInputEvent& Event : Events)
+		{
+			Visitor(Event);
+		}
+		Events.resize(0);
+	}
+}
+
 void FImGuiInputState::ClearUpdateState()
 {
 	bTouchProcessed = bTouchDown;
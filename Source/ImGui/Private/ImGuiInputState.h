@@ -28,6 +28,10 @@
 #include "Utilities/Arrays.h"
 
 #include <Containers/Array.h>
+#include <Templates/Function.h>
+
+
+struct ImGuiInputEvent;
 
 
 // Collects and stores input state and updates for ImGui IO.
@@ -41,6 +45,10 @@ public:
 	// character beyond that limit will be discarded.
 	// @param Char - Character to add
 	void AddCharacter(TCHAR Char);
+
+	// Add a character identified by its code point.
+	// @param CodePoint - Unicode code point of the character
+	void AddCharacterCode(uint32 CodePoint);
 	
 	// Change state of the key in the keys array and expand range bounding dirty part of the array.
 	// @param KeyEvent - Key event representing the key
@@ -52,6 +60,13 @@ public:
 	// @param bIsDown - True, if key is down
 	void SetKeyDown(const FKey& Key, bool bIsDown);
 
+	// Change state of the key identified by ImGui key, for input that doesn't come from Slate (like input received
+	// from a remote viewer).
+	// @param Key - ImGui key
+	// @param bIsDown - True, if key is down
+	// @param AnalogValue - Analogue value of the key
+	void SetKeyDown(ImGuiKey Key, bool bIsDown, float AnalogValue);
+
 	// Change state of the button in the mouse buttons array and expand range bounding dirty part of the array.
 	// @param MouseEvent - Mouse event representing mouse button
 	// @param bIsDown - True, if button is down
@@ -62,6 +77,11 @@ public:
 	// @param bIsDown - True, if button is down
 	void SetMouseDown(const FKey& MouseButton, bool bIsDown);
 
+	// Change state of the button identified by ImGui mouse button index.
+	// @param MouseButton - ImGui mouse button index
+	// @param bIsDown - True, if button is down
+	void SetMouseDown(int32 MouseButton, bool bIsDown);
+
 	// Get mouse wheel delta accumulated during the last frame.
 	float GetMouseWheelDelta() const { return MouseWheelDelta; }
 
@@ -69,6 +89,11 @@ public:
 	// @param DeltaValue - Mouse wheel delta to add
 	void AddMouseWheelDelta(float DeltaValue);
 
+	// Add horizontal and vertical mouse wheel delta.
+	// @param DeltaX - Horizontal mouse wheel delta to add
+	// @param DeltaY - Vertical mouse wheel delta to add
+	void AddMouseWheelDelta(float DeltaX, float DeltaY);
+
 	// Get the mouse position.
 	const FVector2D& GetMousePosition() const { return MousePosition; }
 
@@ -101,6 +126,10 @@ public:
 	// @param Position - Touch position
 	void SetTouchPosition(const FVector2D& Position);
 
+	// Set whether the application has focus. Losing focus releases all keys and buttons.
+	// @param bHasFocus - True, if the application has focus
+	void SetFocus(bool bHasFocus);
+
 	// Get Control down state.
 	bool IsLeftControlDown() const { return bIsLeftControlDown; }
 	bool IsRightControlDown() const { return bIsRightControlDown; }
@@ -168,6 +197,11 @@ public:
 	}
 
 	FORCEINLINE void SetCurrentFrameIO(ImGuiIO* io) { imguiIO = io; }
+
+	// Consume input events queued in the context since its last update. Used while the context isn't updated, to
+	// forward its input elsewhere (e.g. to a remote server).
+	// @param Visitor - Function called for every queued event
+	void ConsumeQueuedEvents(TFunctionRef<void(const ImGuiInputEvent&)> Visitor);
 	
 	// Clear part of the state that is meant to be updated in every frame like: accumulators, buffers, navigation data
 	// and information about dirty parts of keys or mouse buttons arrays.
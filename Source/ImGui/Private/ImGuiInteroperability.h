@@ -139,6 +139,12 @@ namespace ImGuiInterops
 			(uint8)((Color >> IM_COL32_B_SHIFT) & 0xFF), (uint8)((Color >> IM_COL32_A_SHIFT) & 0xFF) };
 	}
 
+	// Convert from FColor to ImGui packed color.
+	FORCEINLINE ImU32 PackImU32Color(const FColor& Color)
+	{
+		return IM_COL32(Color.R, Color.G, Color.B, Color.A);
+	}
+
 	// Convert from ImVec4 rectangle to FSlateRect.
 	FORCEINLINE FSlateRect ToSlateRect(const ImVec4& ImGuiRect)
 	{
@@ -151,6 +157,12 @@ namespace ImGuiInterops
 		return FVector2D{ ImGuiVector.x, ImGuiVector.y };
 	}
 
+	// Convert from FVector2D to ImVec2.
+	FORCEINLINE ImVec2 ToImVec2(const FVector2D& Vector)
+	{
+		return ImVec2{ static_cast<float>(Vector.X), static_cast<float>(Vector.Y) };
+	}
+
 	// Convert from ImGui Texture Id to Texture Index that we use for texture resources.
 	FORCEINLINE TextureIndex ToTextureIndex(ImTextureID Index)
 	{
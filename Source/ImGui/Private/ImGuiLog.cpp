@@ -0,0 +1,416 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ImGuiLog.h"
+
+#include "ImGuiModuleProperties.h"
+
+#include <Algo/BinarySearch.h>
+#include <Async/Async.h>
+#include <CoreGlobals.h>
+#include <Misc/OutputDeviceRedirector.h>
+
+#include <imgui.h>
+
+
+namespace
+{
+	constexpr uint64 TextMask = FImGuiLog::TextCapacity - 1;
+	constexpr uint64 LineMask = FImGuiLog::LineCapacity - 1;
+
+	// Number of lines scanned by the filter under one lock, so logging threads are not blocked for the whole scan.
+	constexpr uint64 LinesPerScanLock = 1024;
+
+	const char* const VerbosityNames[] = { "All", "Log", "Display", "Warning", "Error" };
+	const ELogVerbosity::Type VerbosityLevels[] = { ELogVerbosity::All, ELogVerbosity::Log, ELogVerbosity::Display,
+		ELogVerbosity::Warning, ELogVerbosity::Error };
+}
+
+FImGuiLog::FImGuiLog(FImGuiModuleProperties& InProperties)
+	: Properties(InProperties)
+{
+	Text.SetNumUninitialized(TextCapacity);
+	Lines.SetNumUninitialized(LineCapacity);
+	LineText.Reserve(MaxLineLength + 1);
+
+	GLog->AddOutputDevice(this);
+}
+
+FImGuiLog::~FImGuiLog()
+{
+	if (GLog)
+	{
+		GLog->RemoveOutputDevice(this);
+	}
+
+	// Filter task accesses this object, so it needs to finish before we can be destroyed.
+	if (FilterTask.IsValid())
+	{
+		FilterTask.Wait();
+	}
+}
+
+void FImGuiLog::Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+	// Color changes are passed as messages without text.
+	if (Verbosity == ELogVerbosity::SetColor)
+	{
+		return;
+	}
+
+	const ELogVerbosity::Type LineVerbosity = static_cast<ELogVerbosity::Type>(Verbosity & ELogVerbosity::VerbosityMask);
+
+	FScopeLock Lock(&CriticalSection);
+
+	// Multi-line messages are split, so every line can be drawn as a single row.
+	const TCHAR* LineStart = Message;
+	for (;;)
+	{
+		const TCHAR* LineEnd = LineStart;
+		while (*LineEnd && *LineEnd != TEXT('\n'))
+		{
+			LineEnd++;
+		}
+
+		int32 Length = static_cast<int32>(LineEnd - LineStart);
+		if (Length > 0 && LineStart[Length - 1] == TEXT('\r'))
+		{
+			Length--;
+		}
+
+		// Skip empty line after a trailing line break.
+		if (*LineEnd || LineEnd != LineStart || LineStart == Message)
+		{
+			AddLine(LineStart, FMath::Min(Length, MaxLineLength), LineVerbosity, Category);
+		}
+
+		if (!*LineEnd)
+		{
+			break;
+		}
+		LineStart = LineEnd + 1;
+	}
+}
+
+void FImGuiLog::AddLine(const TCHAR* LineStart, int32 Length, ELogVerbosity::Type Verbosity, const FName& Category)
+{
+	const uint64 NewTextEnd = TextEnd + Length;
+
+	// Release the oldest lines whose text will be overwritten or whose index entry is needed for this line.
+	while (FirstLine < EndLine
+		&& (Lines[FirstLine & LineMask].TextOffset + TextCapacity < NewTextEnd || EndLine - FirstLine >= LineCapacity))
+	{
+		FirstLine++;
+	}
+
+	const int32 Start = static_cast<int32>(TextEnd & TextMask);
+	const int32 FirstPart = FMath::Min(Length, TextCapacity - Start);
+	FMemory::Memcpy(Text.GetData() + Start, LineStart, FirstPart * sizeof(TCHAR));
+	FMemory::Memcpy(Text.GetData(), LineStart + FirstPart, (Length - FirstPart) * sizeof(TCHAR));
+
+	Lines[EndLine & LineMask] = { TextEnd, Category, Length, Verbosity };
+	EndLine++;
+	TextEnd = NewTextEnd;
+}
+
+void FImGuiLog::CopyLineText(const FLine& Line, TArray<TCHAR>& OutText) const
+{
+	const int32 Start = static_cast<int32>(Line.TextOffset & TextMask);
+	const int32 FirstPart = FMath::Min(Line.Length, TextCapacity - Start);
+
+	OutText.Reset();
+	OutText.Append(Text.GetData() + Start, FirstPart);
+	OutText.Append(Text.GetData(), Line.Length - FirstPart);
+	OutText.Add(TEXT('\0'));
+}
+
+FImGuiLog::FFilterResult FImGuiLog::ScanLines(const FFilter& ScanFilter, uint32 ScanFilterVersion, uint64 FromLine, uint64 ToLine) const
+{
+	FFilterResult Result{ ScanFilterVersion, ToLine, {} };
+
+	TArray<TCHAR> ScanText;
+	ScanText.Reserve(MaxLineLength + 1);
+
+	// Consecutive lines often share category, so the last category match is cached.
+	FName LastCategory;
+	bool bHasLastCategory = false;
+	bool bLastCategoryMatches = false;
+
+	for (uint64 ChunkStart = FromLine; ChunkStart < ToLine; ChunkStart += LinesPerScanLock)
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		// Lines overwritten since the scan started are skipped.
+		const uint64 ChunkEnd = FMath::Min(ChunkStart + LinesPerScanLock, ToLine);
+		for (uint64 LineNumber = FMath::Max(ChunkStart, FirstLine); LineNumber < ChunkEnd; LineNumber++)
+		{
+			const FLine& Line = Lines[LineNumber & LineMask];
+
+			if (Line.Verbosity > ScanFilter.MaxVerbosity)
+			{
+				continue;
+			}
+
+			if (!ScanFilter.Category.IsEmpty())
+			{
+				if (!bHasLastCategory || Line.Category != LastCategory)
+				{
+					LastCategory = Line.Category;
+					bHasLastCategory = true;
+					bLastCategoryMatches = Line.Category.ToString().Contains(ScanFilter.Category);
+				}
+
+				if (!bLastCategoryMatches)
+				{
+					continue;
+				}
+			}
+
+			if (!ScanFilter.Text.IsEmpty())
+			{
+				CopyLineText(Line, ScanText);
+				if (!FCString::Strifind(ScanText.GetData(), *ScanFilter.Text))
+				{
+					continue;
+				}
+			}
+
+			Result.Lines.Add(LineNumber);
+		}
+	}
+
+	return Result;
+}
+
+void FImGuiLog::UpdateFilter()
+{
+	if (FilterTask.IsValid() && FilterTask.IsReady())
+	{
+		FFilterResult Result = FilterTask.Consume();
+
+		// Results of a filter that changed during the scan are discarded.
+		if (Result.FilterVersion == FilterVersion)
+		{
+			FilteredLines.Append(Result.Lines);
+			FilteredEndLine = Result.ScannedLines;
+		}
+	}
+
+	if (!Filter.IsActive())
+	{
+		return;
+	}
+
+	uint64 CurrentFirstLine = 0;
+	uint64 CurrentEndLine = 0;
+	{
+		FScopeLock Lock(&CriticalSection);
+		CurrentFirstLine = FirstLine;
+		CurrentEndLine = EndLine;
+	}
+
+	// Drop results for lines that were overwritten.
+	const int32 NumOverwritten = Algo::LowerBound(FilteredLines, CurrentFirstLine);
+	if (NumOverwritten > 0)
+	{
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4)
+		FilteredLines.RemoveAt(0, NumOverwritten, EAllowShrinking::No);
+#else
+		FilteredLines.RemoveAt(0, NumOverwritten, false);
+#endif
+	}
+
+	// Scan only lines added since the last scan.
+	if (!FilterTask.IsValid() && FilteredEndLine < CurrentEndLine)
+	{
+		const uint64 FromLine = FMath::Max(FilteredEndLine, CurrentFirstLine);
+		FilterTask = Async(EAsyncExecution::ThreadPool,
+			[this, ScanFilter = Filter, ScanFilterVersion = FilterVersion, FromLine, ToLine = CurrentEndLine]()
+			{
+				return ScanLines(ScanFilter, ScanFilterVersion, FromLine, ToLine);
+			});
+	}
+}
+
+void FImGuiLog::ResetFilterResults()
+{
+	FilterVersion++;
+	FilteredLines.Reset();
+	FilteredEndLine = 0;
+}
+
+void FImGuiLog::Clear()
+{
+	{
+		FScopeLock Lock(&CriticalSection);
+		FirstLine = EndLine;
+	}
+
+	ResetFilterResults();
+}
+
+void FImGuiLog::DrawControls()
+{
+	if (!Properties.ShowLog())
+	{
+		return;
+	}
+
+	// Filter results are shared by all contexts, so they are updated once per frame.
+	if (LastFilterFrameNumber != GFrameNumber)
+	{
+		LastFilterFrameNumber = GFrameNumber;
+		UpdateFilter();
+	}
+
+	bool bOpen = true;
+	ImGui::SetNextWindowSize(ImVec2(800.f, 400.f), ImGuiCond_FirstUseEver);
+	if (ImGui::Begin("Log", &bOpen))
+	{
+		DrawFilterControls();
+		ImGui::Separator();
+
+		if (ImGui::BeginChild("##Lines", ImVec2(0.f, 0.f), ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar))
+		{
+			DrawLines();
+		}
+		ImGui::EndChild();
+	}
+	ImGui::End();
+
+	if (!bOpen)
+	{
+		Properties.SetShowLog(false);
+	}
+}
+
+void FImGuiLog::DrawFilterControls()
+{
+	bool bFilterChanged = false;
+
+	if (ImGui::Button("Clear"))
+	{
+		Clear();
+	}
+
+	ImGui::SameLine();
+	ImGui::Checkbox("Auto-scroll", &bAutoScroll);
+
+	ImGui::SameLine();
+	int VerbosityIndex = 0;
+	while (VerbosityIndex < static_cast<int>(UE_ARRAY_COUNT(VerbosityLevels)) - 1 && VerbosityLevels[VerbosityIndex] != Filter.MaxVerbosity)
+	{
+		VerbosityIndex++;
+	}
+	ImGui::SetNextItemWidth(100.f);
+	if (ImGui::Combo("Verbosity", &VerbosityIndex, VerbosityNames, static_cast<int>(UE_ARRAY_COUNT(VerbosityNames))))
+	{
+		Filter.MaxVerbosity = VerbosityLevels[VerbosityIndex];
+		bFilterChanged = true;
+	}
+
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(150.f);
+	if (ImGui::InputText("Category", FilterCategoryBuffer, sizeof(FilterCategoryBuffer)))
+	{
+		Filter.Category = UTF8_TO_TCHAR(FilterCategoryBuffer);
+		bFilterChanged = true;
+	}
+
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(-FLT_MIN);
+	if (ImGui::InputTextWithHint("##Text", "Text", FilterTextBuffer, sizeof(FilterTextBuffer)))
+	{
+		Filter.Text = UTF8_TO_TCHAR(FilterTextBuffer);
+		bFilterChanged = true;
+	}
+
+	if (bFilterChanged)
+	{
+		ResetFilterResults();
+	}
+}
+
+void FImGuiLog::DrawLines()
+{
+	uint64 CurrentFirstLine = 0;
+	uint64 CurrentEndLine = 0;
+	{
+		FScopeLock Lock(&CriticalSection);
+		CurrentFirstLine = FirstLine;
+		CurrentEndLine = EndLine;
+	}
+
+	const bool bFiltered = Filter.IsActive();
+	const int32 FirstFiltered = bFiltered ? Algo::LowerBound(FilteredLines, CurrentFirstLine) : 0;
+	const int32 NumRows = bFiltered ? FilteredLines.Num() - FirstFiltered : static_cast<int32>(CurrentEndLine - CurrentFirstLine);
+
+	// Only visible rows are copied and drawn.
+	ImGuiListClipper Clipper;
+	Clipper.Begin(NumRows);
+	while (Clipper.Step())
+	{
+		for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+		{
+			const uint64 LineNumber = bFiltered ? FilteredLines[FirstFiltered + Row] : CurrentFirstLine + Row;
+
+			ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+			{
+				FScopeLock Lock(&CriticalSection);
+
+				// Line could be overwritten since rows were counted.
+				if (LineNumber >= FirstLine)
+				{
+					const FLine& Line = Lines[LineNumber & LineMask];
+					CopyLineText(Line, LineText);
+					Verbosity = Line.Verbosity;
+				}
+				else
+				{
+					LineText.Reset();
+					LineText.Add(TEXT('\0'));
+				}
+			}
+
+			const bool bHighlight = Verbosity <= ELogVerbosity::Warning;
+			if (bHighlight)
+			{
+				const ImVec4 Color = (Verbosity <= ELogVerbosity::Error) ? ImVec4(1.f, 0.4f, 0.4f, 1.f) : ImVec4(1.f, 0.8f, 0.3f, 1.f);
+				ImGui::PushStyleColor(ImGuiCol_Text, Color);
+			}
+
+			ImGui::TextUnformatted(TCHAR_TO_UTF8(LineText.GetData()));
+
+			if (bHighlight)
+			{
+				ImGui::PopStyleColor();
+			}
+		}
+	}
+
+	if (bAutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+	{
+		ImGui::SetScrollHereY(1.f);
+	}
+}
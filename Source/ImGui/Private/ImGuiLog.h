@@ -0,0 +1,132 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Async/Future.h>
+#include <Misc/OutputDevice.h>
+
+class FImGuiModuleProperties;
+
+// Log output device capturing messages to fixed-size ring buffers and a window to browse them.
+//
+// Capture copies each line to a ring buffer of characters and adds an entry to a ring index of lines, which are both
+// allocated once, so log floods don't allocate and only overwrite the oldest lines. Lines are identified by absolute
+// numbers, which can be used to check whether a line is still available.
+//
+// Window draws only visible lines. Filtering runs incrementally in the thread pool, scanning only lines logged since
+// the last scan, and its results are cached until the filter changes.
+class FImGuiLog : public FOutputDevice
+{
+public:
+
+	// Number of characters kept in the ring buffer.
+	static constexpr int32 TextCapacity = 1 << 20;
+
+	// Number of lines kept in the ring index.
+	static constexpr int32 LineCapacity = 1 << 16;
+
+	// Longer lines are truncated.
+	static constexpr int32 MaxLineLength = 1024;
+
+	FImGuiLog(FImGuiModuleProperties& InProperties);
+	virtual ~FImGuiLog();
+
+	FImGuiLog(const FImGuiLog&) = delete;
+	FImGuiLog& operator=(const FImGuiLog&) = delete;
+
+	void DrawControls();
+
+	//~ FOutputDevice interface
+	virtual void Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category) override;
+	virtual bool CanBeUsedOnAnyThread() const override { return true; }
+	virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+
+private:
+
+	struct FLine
+	{
+		uint64 TextOffset;
+		FName Category;
+		int32 Length;
+		ELogVerbosity::Type Verbosity;
+	};
+
+	struct FFilter
+	{
+		FString Text;
+		FString Category;
+		ELogVerbosity::Type MaxVerbosity = ELogVerbosity::All;
+
+		bool IsActive() const { return !Text.IsEmpty() || !Category.IsEmpty() || MaxVerbosity != ELogVerbosity::All; }
+	};
+
+	struct FFilterResult
+	{
+		uint32 FilterVersion = 0;
+		uint64 ScannedLines = 0;
+		TArray<uint64> Lines;
+	};
+
+	// Add a single line. Needs to be called with locked critical section.
+	void AddLine(const TCHAR* LineStart, int32 Length, ELogVerbosity::Type Verbosity, const FName& Category);
+
+	// Copy text of a line that is still available. Needs to be called with locked critical section.
+	void CopyLineText(const FLine& Line, TArray<TCHAR>& OutText) const;
+
+	// Scan lines from the given range and return those that pass the filter. Called from the thread pool.
+	FFilterResult ScanLines(const FFilter& ScanFilter, uint32 ScanFilterVersion, uint64 FromLine, uint64 ToLine) const;
+
+	void UpdateFilter();
+	void ResetFilterResults();
+	void Clear();
+
+	void DrawFilterControls();
+	void DrawLines();
+
+	FImGuiModuleProperties& Properties;
+
+	mutable FCriticalSection CriticalSection;
+
+	// Guarded by the critical section.
+	TArray<TCHAR> Text;
+	TArray<FLine> Lines;
+	uint64 TextEnd = 0;
+	uint64 FirstLine = 0;
+	uint64 EndLine = 0;
+
+	// Accessed only on the game thread.
+	FFilter Filter;
+	uint32 FilterVersion = 0;
+	TArray<uint64> FilteredLines;
+	uint64 FilteredEndLine = 0;
+	TFuture<FFilterResult> FilterTask;
+	uint32 LastFilterFrameNumber = 0;
+
+	char FilterTextBuffer[256] = {};
+	char FilterCategoryBuffer[128] = {};
+	TArray<TCHAR> LineText;
+	bool bAutoScroll = true;
+};
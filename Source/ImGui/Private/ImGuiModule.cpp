@@ -134,6 +134,21 @@ void FImGuiModule::RebuildFontAtlas()
 	}
 }
 
+TSharedRef<FImGuiDeferredDrawProducer, ESPMode::ThreadSafe> FImGuiModule::CreateDeferredDrawProducer(const UWorld* World,
+	const FString& Name, int32 MaxPendingBytes)
+{
+	checkf(IsInGameThread(), TEXT("Deferred draw producers need to be created on the game thread."));
+
+	if (!World)
+	{
+		World = (UWorld*)GWorld;
+	}
+	checkf(World, TEXT("Trying to create a deferred draw producer '%s' outside of a world context."), *Name);
+
+	FImGuiContextProxy& Proxy = ImGuiModuleManager->GetContextManager().GetWorldContextProxy(*World);
+	return MakeShareable(new FImGuiDeferredDrawProducer(Name, MaxPendingBytes, Proxy.GetDeferredDrawQueue()));
+}
+
 void FImGuiModule::StartupModule()
 {
 	// Initialize handles to allow cross-module redirections. Other handles will always look for parents in the active
@@ -145,6 +160,7 @@ void FImGuiModule::StartupModule()
 
 #if WITH_EDITOR
 	ImGuiContextHandle = &ImGuiImplementation::GetContextHandle();
+	ImPlotContextHandle = &ImGuiImplementation::GetPlotContextHandle();
 	DelegatesContainerHandle = &FImGuiDelegatesContainer::GetHandle();
 #endif
 
@@ -203,6 +219,11 @@ void FImGuiModule::ShutdownModule()
 					ImGuiImplementation::SetParentContextHandle(*LoadedModule.ImGuiContextHandle);
 				}
 
+				if (LoadedModule.ImPlotContextHandle)
+				{
+					ImGuiImplementation::SetParentPlotContextHandle(*LoadedModule.ImPlotContextHandle);
+				}
+
 				if (LoadedModule.DelegatesContainerHandle)
 				{
 					FImGuiDelegatesContainer::MoveContainer(*LoadedModule.DelegatesContainerHandle);
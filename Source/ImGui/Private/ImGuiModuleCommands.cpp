@@ -27,6 +27,11 @@
 #include "ImGuiModuleProperties.h"
 #include "Utilities/DebugExecBindings.h"
 
+#include <Math/RandomStream.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
 
 const TCHAR* const FImGuiModuleCommands::ToggleInput = TEXT("ImGui.ToggleInput");
 const TCHAR* const FImGuiModuleCommands::ToggleKeyboardNavigation = TEXT("ImGui.ToggleKeyboardNavigation");
@@ -36,6 +41,151 @@ const TCHAR* const FImGuiModuleCommands::ToggleGamepadInputSharing = TEXT("ImGui
 const TCHAR* const FImGuiModuleCommands::ToggleMouseInputSharing = TEXT("ImGui.ToggleMouseInputSharing");
 const TCHAR* const FImGuiModuleCommands::SetMouseInputSharing = TEXT("ImGui.SetMouseInputSharing");
 const TCHAR* const FImGuiModuleCommands::ToggleDemo = TEXT("ImGui.ToggleDemo");
+const TCHAR* const FImGuiModuleCommands::ToggleLog = TEXT("ImGui.ToggleLog");
+const TCHAR* const FImGuiModuleCommands::BenchmarkStorage = TEXT("ImGui.BenchmarkStorage");
+const TCHAR* const FImGuiModuleCommands::BenchmarkPolyline = TEXT("ImGui.BenchmarkPolyline");
+const TCHAR* const FImGuiModuleCommands::BenchmarkWidgets = TEXT("ImGui.BenchmarkWidgets");
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiBenchmark, Log, All);
+
+namespace
+{
+	// Sorted insertion moves half of the storage on average, so with many keys it could take hours. Inserting stops
+	// after this time and throughput is calculated from keys inserted so far.
+	constexpr double StorageInsertTimeLimit = 2.0;
+
+	struct FStorageBenchmarkResult
+	{
+		double InsertsPerSecond = 0.0;
+		double LookupsPerSecond = 0.0;
+		int32 NumInserted = 0;
+	};
+
+	FStorageBenchmarkResult RunStorageBenchmark(const TArray<ImGuiID>& Keys, const TArray<ImGuiID>& LookupKeys, bool bHashIndex)
+	{
+		FStorageBenchmarkResult Result;
+
+		// Insertion in random order, like tree nodes opened in a big hierarchy.
+		{
+			ImGuiStorage Storage;
+			Storage.SetHashIndex(bHashIndex);
+			const double StartTime = FPlatformTime::Seconds();
+			double ElapsedTime = 0.0;
+			for (const ImGuiID Key : Keys)
+			{
+				Storage.SetInt(Key, 1);
+				if ((++Result.NumInserted & 1023) == 0)
+				{
+					ElapsedTime = FPlatformTime::Seconds() - StartTime;
+					if (ElapsedTime > StorageInsertTimeLimit)
+					{
+						break;
+					}
+				}
+			}
+			ElapsedTime = FPlatformTime::Seconds() - StartTime;
+			Result.InsertsPerSecond = Result.NumInserted / FMath::Max(ElapsedTime, SMALL_NUMBER);
+		}
+
+		// Lookups in a fully populated storage (built in bulk, so sorted storage doesn't need to finish insertion).
+		{
+			ImGuiStorage Storage;
+			Storage.Data.reserve(Keys.Num());
+			for (const ImGuiID Key : Keys)
+			{
+				Storage.Data.push_back(ImGuiStoragePair(Key, 1));
+			}
+			Storage.BuildSortByKey();
+			Storage.SetHashIndex(bHashIndex);
+
+			int32 Sum = 0;
+			const double StartTime = FPlatformTime::Seconds();
+			for (const ImGuiID Key : LookupKeys)
+			{
+				Sum += Storage.GetInt(Key);
+			}
+			const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+			Result.LookupsPerSecond = LookupKeys.Num() / FMath::Max(ElapsedTime, SMALL_NUMBER);
+			checkf(Sum == LookupKeys.Num(), TEXT("Storage benchmark failed to find %d keys."), LookupKeys.Num() - Sum);
+		}
+
+		return Result;
+	}
+
+	// Number of points tessellated for each polyline benchmark case, split into repeated calls.
+	constexpr int32 PolylineBenchmarkPoints = 4 * 1024 * 1024;
+
+	// Scalar and SIMD polyline positions and UVs only need to match within float rounding, as compiler can contract or
+	// reassociate the scalar expressions (e.g. into FMA).
+	constexpr float PolylineTolerance = 1e-3f;
+
+	bool IsPolylineVertexEqual(const ImDrawVert& Vertex, const ImDrawVert& Reference)
+	{
+		return FMath::IsNearlyEqual(Vertex.pos.x, Reference.pos.x, PolylineTolerance)
+			&& FMath::IsNearlyEqual(Vertex.pos.y, Reference.pos.y, PolylineTolerance)
+			&& FMath::IsNearlyEqual(Vertex.uv.x, Reference.uv.x, PolylineTolerance)
+			&& FMath::IsNearlyEqual(Vertex.uv.y, Reference.uv.y, PolylineTolerance)
+			&& Vertex.col == Reference.col;
+	}
+
+	// Tessellate polyline repeatedly and return time per point in nanoseconds.
+	double RunPolylineBenchmark(ImDrawList& DrawList, const TArray<ImVec2>& Points, float Thickness, bool bSIMD)
+	{
+		DrawList._Data->DisableSIMD = !bSIMD;
+		const int32 NumIterations = FMath::Max(PolylineBenchmarkPoints / Points.Num(), 1);
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			DrawList._ResetForNewFrame();
+			DrawList.AddPolyline(Points.GetData(), Points.Num(), IM_COL32_WHITE, ImDrawFlags_None, Thickness);
+		}
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+		return ElapsedTime * 1e9 / (static_cast<double>(NumIterations) * Points.Num());
+	}
+
+	// Number of windows drawn in each frame of the widget benchmark.
+	constexpr int32 WidgetBenchmarkWindows = 20;
+
+	// Draw one frame of a typical debug workload: windows with text, buttons, sliders and tree nodes. Nearly every ImGui
+	// call reads the current context, so time of this workload reflects the cost of accessing it.
+	void DrawWidgetBenchmarkFrame(float& Value)
+	{
+		ImGui::NewFrame();
+
+		for (int32 WindowIndex = 0; WindowIndex < WidgetBenchmarkWindows; WindowIndex++)
+		{
+			char WindowName[32];
+			FCStringAnsi::Snprintf(WindowName, sizeof(WindowName), "Benchmark %d", WindowIndex);
+
+			ImGui::SetNextWindowPos(ImVec2((WindowIndex % 5) * 300.f, (WindowIndex / 5) * 260.f));
+			ImGui::SetNextWindowSize(ImVec2(290.f, 250.f));
+			ImGui::Begin(WindowName);
+
+			for (int32 Row = 0; Row < 8; Row++)
+			{
+				ImGui::PushID(Row);
+				ImGui::Text("Value %d: %.3f", Row, Value * Row);
+				ImGui::SameLine();
+				ImGui::SmallButton("Reset");
+				ImGui::PopID();
+			}
+
+			ImGui::SliderFloat("Value", &Value, 0.f, 1.f);
+			ImGui::SetNextItemOpen(true);
+			if (ImGui::TreeNode("Details"))
+			{
+				ImGui::BulletText("Window %d", WindowIndex);
+				bool bEnabled = (WindowIndex % 2) == 0;
+				ImGui::Checkbox("Enabled", &bEnabled);
+				ImGui::TreePop();
+			}
+
+			ImGui::End();
+		}
+
+		ImGui::Render();
+	}
+}
 
 FImGuiModuleCommands::FImGuiModuleCommands(FImGuiModuleProperties& InProperties)
 	: Properties(InProperties)
@@ -63,6 +213,18 @@ FImGuiModuleCommands::FImGuiModuleCommands(FImGuiModuleProperties& InProperties)
 	, ToggleDemoCommand(ToggleDemo,
 		TEXT("Toggle ImGui demo."),
 		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::ToggleDemoImpl))
+	, ToggleLogCommand(ToggleLog,
+		TEXT("Toggle ImGui log window."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::ToggleLogImpl))
+	, BenchmarkStorageCommand(BenchmarkStorage,
+		TEXT("Compare insert and lookup throughput of sorted and hashed ImGuiStorage with 1k, 100k and 1M keys."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::BenchmarkStorageImpl))
+	, BenchmarkPolylineCommand(BenchmarkPolyline,
+		TEXT("Compare scalar and SIMD anti-aliased polyline tessellation with 64, 1k and 8k points and thickness 1, 2.5 and 4."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::BenchmarkPolylineImpl))
+	, BenchmarkWidgetsCommand(BenchmarkWidgets,
+		TEXT("Measure time of a frame with 20 windows of common widgets. Compare results from editor and game builds to see the cost of context access."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::BenchmarkWidgetsImpl))
 {
 }
 
@@ -115,3 +277,138 @@ void FImGuiModuleCommands::ToggleDemoImpl()
 {
 	Properties.ToggleDemo();
 }
+
+void FImGuiModuleCommands::ToggleLogImpl()
+{
+	Properties.ToggleLog();
+}
+
+void FImGuiModuleCommands::BenchmarkStorageImpl()
+{
+	FRandomStream Random(0x5EED);
+
+	for (const int32 NumKeys : { 1000, 100000, 1000000 })
+	{
+		// Unique random keys, similar to IDs of tree nodes.
+		TSet<ImGuiID> UniqueKeys;
+		UniqueKeys.Reserve(NumKeys);
+		while (UniqueKeys.Num() < NumKeys)
+		{
+			UniqueKeys.Add(static_cast<ImGuiID>(Random.GetUnsignedInt()));
+		}
+		const TArray<ImGuiID> Keys = UniqueKeys.Array();
+
+		// Enough lookups to get a stable time, in a different order than insertion.
+		const int32 NumLookups = FMath::Max(NumKeys, 1000000);
+		TArray<ImGuiID> LookupKeys;
+		LookupKeys.Reserve(NumLookups);
+		while (LookupKeys.Num() < NumLookups)
+		{
+			LookupKeys.Add(Keys[Random.RandHelper(NumKeys)]);
+		}
+
+		for (const bool bHashIndex : { false, true })
+		{
+			const FStorageBenchmarkResult Result = RunStorageBenchmark(Keys, LookupKeys, bHashIndex);
+			UE_LOG(LogImGuiBenchmark, Display, TEXT("ImGuiStorage %-6s %7d keys: %8.2f M inserts/s%s, %8.2f M lookups/s"),
+				bHashIndex ? TEXT("hashed") : TEXT("sorted"), NumKeys, Result.InsertsPerSecond / 1e6,
+				(Result.NumInserted < NumKeys) ? *FString::Printf(TEXT(" (stopped after %d keys)"), Result.NumInserted) : TEXT(""),
+				Result.LookupsPerSecond / 1e6);
+		}
+	}
+}
+
+void FImGuiModuleCommands::BenchmarkPolylineImpl()
+{
+	// Draw lists are used without a context, so the shared data only needs flags. Lines with a texture are not tested, as
+	// they need a font atlas and differ from the non-thick path only in vertex emission.
+	ImDrawListSharedData SharedData;
+	SharedData.InitialFlags = ImDrawListFlags_AntiAliasedLines;
+	ImDrawList DrawList(&SharedData);
+	ImDrawList ReferenceDrawList(&SharedData);
+
+	// With 16-bit indices, one polyline can have at most 64k vertices, so 16k points in the thick path.
+	for (const int32 NumPoints : { 64, 1024, 8192 })
+	{
+		// A wavy trail, similar to trajectories and plot lines.
+		TArray<ImVec2> Points;
+		Points.Reserve(NumPoints);
+		for (int32 Index = 0; Index < NumPoints; Index++)
+		{
+			Points.Add(ImVec2(Index * 0.25f, 300.f + 100.f * FMath::Sin(Index * 0.05f)));
+		}
+
+		for (const float Thickness : { 1.f, 2.5f, 4.f })
+		{
+			const double ScalarTime = RunPolylineBenchmark(ReferenceDrawList, Points, Thickness, false);
+			const double SIMDTime = RunPolylineBenchmark(DrawList, Points, Thickness, true);
+
+			// Count vertices and indices that differ, including missing or extra ones. Vertices are compared within the
+			// tolerance, while colors and indices need to match exactly.
+			const auto CountMismatches = [](const auto& Buffer, const auto& ReferenceBuffer, const auto& IsEqual)
+			{
+				const int32 NumCommon = FMath::Min(Buffer.Size, ReferenceBuffer.Size);
+				int32 NumMismatches = FMath::Abs(Buffer.Size - ReferenceBuffer.Size);
+				for (int32 Index = 0; Index < NumCommon; Index++)
+				{
+					if (!IsEqual(Buffer.Data[Index], ReferenceBuffer.Data[Index]))
+					{
+						NumMismatches++;
+					}
+				}
+				return NumMismatches;
+			};
+
+			const int32 NumVertexMismatches = CountMismatches(DrawList.VtxBuffer, ReferenceDrawList.VtxBuffer, IsPolylineVertexEqual);
+			const int32 NumIndexMismatches = CountMismatches(DrawList.IdxBuffer, ReferenceDrawList.IdxBuffer,
+				[](ImDrawIdx Index, ImDrawIdx Reference) { return Index == Reference; });
+			if (NumVertexMismatches > 0 || NumIndexMismatches > 0)
+			{
+				UE_LOG(LogImGuiBenchmark, Error, TEXT("Scalar and SIMD polyline output differ beyond float rounding (%d points, thickness %.1f): %d of %d vertices and %d of %d indices mismatch."),
+					NumPoints, Thickness, NumVertexMismatches, ReferenceDrawList.VtxBuffer.Size, NumIndexMismatches, ReferenceDrawList.IdxBuffer.Size);
+			}
+
+			UE_LOG(LogImGuiBenchmark, Display, TEXT("AddPolyline %5d points, thickness %.1f: scalar %6.2f ns/point, SIMD %6.2f ns/point (x%.2f)"),
+				NumPoints, Thickness, ScalarTime, SIMDTime, ScalarTime / FMath::Max(SIMDTime, SMALL_NUMBER));
+		}
+	}
+}
+
+void FImGuiModuleCommands::BenchmarkWidgetsImpl()
+{
+	// Run in a separate context, so the benchmark doesn't depend on and doesn't affect state of module contexts.
+	ImGuiContext* PreviousContext = ImGui::GetCurrentContext();
+	ImGuiContext* Context = ImGui::CreateContext();
+	ImGui::SetCurrentContext(Context);
+
+	ImGuiIO& IO = ImGui::GetIO();
+	IO.DisplaySize = ImVec2(1920.f, 1080.f);
+	IO.DeltaTime = 1.f / 60.f;
+	IO.IniFilename = nullptr;
+
+	unsigned char* Pixels;
+	int Width, Height;
+	IO.Fonts->GetTexDataAsAlpha8(&Pixels, &Width, &Height);
+
+	float Value = 0.5f;
+	for (int32 Frame = 0; Frame < 10; Frame++)
+	{
+		DrawWidgetBenchmarkFrame(Value);
+	}
+
+	constexpr int32 NumFrames = 500;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		DrawWidgetBenchmarkFrame(Value);
+	}
+	const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+	const int32 NumVertices = ImGui::GetDrawData()->TotalVtxCount;
+
+	ImGui::DestroyContext(Context);
+	ImGui::SetCurrentContext(PreviousContext);
+
+	UE_LOG(LogImGuiBenchmark, Display, TEXT("Widgets (%s build): %.3f ms/frame, %.2f us/window, %d vertices per frame"),
+		WITH_EDITOR ? TEXT("editor") : TEXT("game"), ElapsedTime * 1e3 / NumFrames,
+		ElapsedTime * 1e6 / (static_cast<double>(NumFrames) * WidgetBenchmarkWindows), NumVertices);
+}
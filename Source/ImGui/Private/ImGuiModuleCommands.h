@@ -43,6 +43,10 @@ public:
 	static const TCHAR* const ToggleMouseInputSharing;
 	static const TCHAR* const SetMouseInputSharing;
 	static const TCHAR* const ToggleDemo;
+	static const TCHAR* const ToggleLog;
+	static const TCHAR* const BenchmarkStorage;
+	static const TCHAR* const BenchmarkPolyline;
+	static const TCHAR* const BenchmarkWidgets;
 
 	FImGuiModuleCommands(FImGuiModuleProperties& InProperties);
 
@@ -58,6 +62,10 @@ private:
 	void ToggleMouseInputSharingImpl();
 	void SetMouseInputSharingImpl(const TArray< FString >& Args);
 	void ToggleDemoImpl();
+	void ToggleLogImpl();
+	void BenchmarkStorageImpl();
+	void BenchmarkPolylineImpl();
+	void BenchmarkWidgetsImpl();
 
 	FImGuiModuleProperties& Properties;
 
@@ -69,4 +77,8 @@ private:
 	FAutoConsoleCommand ToggleMouseInputSharingCommand;
 	FAutoConsoleCommand SetMouseInputSharingCommand;
 	FAutoConsoleCommand ToggleDemoCommand;
+	FAutoConsoleCommand ToggleLogCommand;
+	FAutoConsoleCommand BenchmarkStorageCommand;
+	FAutoConsoleCommand BenchmarkPolylineCommand;
+	FAutoConsoleCommand BenchmarkWidgetsCommand;
 };
@@ -36,3 +36,9 @@
 
 // Input Handler logger (used also in non-developer mode to raise problems with handler extensions).
 DECLARE_LOG_CATEGORY_EXTERN(LogImGuiInputHandler, Warning, All);
+
+// Draw data capture and replay logger.
+DECLARE_LOG_CATEGORY_EXTERN(LogImGuiCapture, Log, All);
+
+// Remote server and viewer logger.
+DECLARE_LOG_CATEGORY_EXTERN(LogImGuiRemote, Log, All);
@@ -25,30 +25,57 @@
 #include "ImGuiModuleManager.h"
 
 #include "ImGuiInteroperability.h"
+#include "ImGuiModuleDebug.h"
 #include "Utilities/WorldContextIndex.h"
 
 #include <Framework/Application/SlateApplication.h>
+#include <Misc/App.h>
 #include <Modules/ModuleManager.h>
 
 #include <imgui.h>
+#include <implot.h>
 
 
 // High enough z-order guarantees that ImGui output is rendered on top of the game UI.
 static constexpr int32 IMGUI_WIDGET_Z_ORDER = 10000;
 
+// Default port of the remote server and viewer.
+static constexpr int32 IMGUI_REMOTE_DEFAULT_PORT = 7780;
+
 // Module texture names.
 const static FName PlainTextureName = "ImGuiModule_Plain";
 const static FName FontAtlasTextureName = "ImGuiModule_FontAtlas";
+const static FName PlotTextureName = "ImGuiModule_Plot";
 
 FImGuiModuleManager::FImGuiModuleManager()
 	: Commands(Properties)
 	, Settings(Properties, Commands)
 	, ImGuiDemo(Properties)
+	, ImGuiLog(Properties)
 	, ContextManager(Settings)
+	, StartRemoteServerCommand(TEXT("ImGui.Remote.StartServer"),
+		TEXT("Start streaming ImGui output of the current world context to a remote viewer. Optional argument: port."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateRaw(this, &FImGuiModuleManager::StartRemoteServerImpl))
+	, StopRemoteServerCommand(TEXT("ImGui.Remote.StopServer"),
+		TEXT("Stop streaming ImGui output to a remote viewer."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleManager::StopRemoteServerImpl))
+	, ConnectRemoteCommand(TEXT("ImGui.Remote.Connect"),
+		TEXT("Present ImGui output of a remote server in the current world context. Optional arguments: address, port."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateRaw(this, &FImGuiModuleManager::ConnectRemoteImpl))
+	, DisconnectRemoteCommand(TEXT("ImGui.Remote.Disconnect"),
+		TEXT("Disconnect from a remote server."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleManager::DisconnectRemoteImpl))
+	, PrintRemoteStatsCommand(TEXT("ImGui.Remote.Stats"),
+		TEXT("Print ImGui remote server and viewer statistics."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleManager::PrintRemoteStatsImpl))
 {
 	// Register in context manager to get information whenever a new context proxy is created.
 	ContextManager.OnContextProxyCreated.AddRaw(this, &FImGuiModuleManager::OnContextProxyCreated);
 
+	// Start or stop remote server when settings are loaded or changed.
+	Settings.OnRemoteServerChangedDelegate.AddRaw(this, &FImGuiModuleManager::UpdateRemoteServer);
+	UpdateRemoteServer();
+
 	// Typically we will use viewport created events to add widget to new game viewports.
 	ViewportCreatedHandle = UGameViewportClient::OnViewportCreated().AddRaw(this, &FImGuiModuleManager::OnViewportCreated);
 
@@ -69,6 +96,17 @@ FImGuiModuleManager::FImGuiModuleManager()
 FImGuiModuleManager::~FImGuiModuleManager()
 {
 	ContextManager.OnFontAtlasBuilt.RemoveAll(this);
+	Settings.OnRemoteServerChangedDelegate.RemoveAll(this);
+
+	// Texture manager is destroyed before contexts, so they can't release their textures after this point (they are
+	// released together with the texture manager).
+	if (bTexturesLoaded)
+	{
+		ImPlot::SetTextureFunctions(nullptr, nullptr, nullptr);
+	}
+
+	DisconnectRemoteImpl();
+	StopRemoteServer();
 
 	// We are no longer interested with adding widgets to viewports.
 	if (ViewportCreatedHandle.IsValid())
@@ -118,6 +156,9 @@ void FImGuiModuleManager::LoadTextures()
 		ContextManager.OnFontAtlasBuilt.AddRaw(this, &FImGuiModuleManager::BuildFontAtlasTexture);
 
 		BuildFontAtlasTexture();
+
+		// From now on, ImPlot can render to textures (e.g. heatmaps).
+		ImPlot::SetTextureFunctions(&FImGuiModuleManager::UpdatePlotTexture, &FImGuiModuleManager::ReleasePlotTexture, this);
 	}
 }
 
@@ -136,6 +177,39 @@ void FImGuiModuleManager::BuildFontAtlasTexture()
 	Fonts.TexID = ImGuiInterops::ToImTextureID(FontsTexureIndex);
 }
 
+ImTextureID FImGuiModuleManager::UpdatePlotTexture(ImTextureID Texture, const ImU32* Pixels, int Width, int Height, void* UserData)
+{
+	FImGuiModuleManager* This = static_cast<FImGuiModuleManager*>(UserData);
+	FTextureManager& TextureManager = This->TextureManager;
+
+	// Update textures that we created before or create a new one with a unique name.
+	FName Name = Texture ? TextureManager.GetTextureName(ImGuiInterops::ToTextureIndex(Texture)) : NAME_None;
+	if (Name.IsNone())
+	{
+		Name = FName(PlotTextureName, ++This->PlotTextureCounter);
+	}
+
+	// Texture is updated asynchronously, so we need to copy data. While doing that, we convert ImGui colors to the
+	// packed ARGB format used by transient textures.
+	const int32 NumPixels = Width * Height;
+	uint32* Data = new uint32[NumPixels];
+	for (int32 PixelIndex = 0; PixelIndex < NumPixels; PixelIndex++)
+	{
+		const uint32 Color = Pixels[PixelIndex];
+		Data[PixelIndex] = (Color & 0xFF00FF00) | ((Color & 0x000000FF) << 16) | ((Color & 0x00FF0000) >> 16);
+	}
+	auto DataCleanup = [](uint8* Ptr) { delete[] reinterpret_cast<uint32*>(Ptr); };
+
+	const TextureIndex Index = TextureManager.UpdateTexture(Name, Width, Height, sizeof(uint32), reinterpret_cast<uint8*>(Data), DataCleanup, true);
+	return ImGuiInterops::ToImTextureID(Index);
+}
+
+void FImGuiModuleManager::ReleasePlotTexture(ImTextureID Texture, void* UserData)
+{
+	FImGuiModuleManager* This = static_cast<FImGuiModuleManager*>(UserData);
+	This->TextureManager.ReleaseTextureResources(ImGuiInterops::ToTextureIndex(Texture));
+}
+
 void FImGuiModuleManager::RegisterTick()
 {
 	// Slate Post-Tick is a good moment to end and advance ImGui frame as it minimises a tearing.
@@ -143,6 +217,17 @@ void FImGuiModuleManager::RegisterTick()
 	{
 		TickDelegateHandle = FSlateApplication::Get().OnPostTick().AddRaw(this, &FImGuiModuleManager::Tick);
 	}
+
+	// Without rendering (e.g. dedicated servers) there is no Slate, so we need to use core ticker. In that mode
+	// contexts can be only accessed through remote server.
+	if (!IsTickRegistered() && !FApp::CanEverRender())
+	{
+#if ENGINE_COMPATIBILITY_LEGACY_CORE_TICKER
+		CoreTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FImGuiModuleManager::TickCoreTicker));
+#else
+		CoreTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FImGuiModuleManager::TickCoreTicker));
+#endif
+	}
 }
 
 void FImGuiModuleManager::UnregisterTick()
@@ -155,6 +240,16 @@ void FImGuiModuleManager::UnregisterTick()
 		}
 		TickDelegateHandle.Reset();
 	}
+
+	if (CoreTickerHandle.IsValid())
+	{
+#if ENGINE_COMPATIBILITY_LEGACY_CORE_TICKER
+		FTicker::GetCoreTicker().RemoveTicker(CoreTickerHandle);
+#else
+		FTSTicker::GetCoreTicker().RemoveTicker(CoreTickerHandle);
+#endif
+		CoreTickerHandle.Reset();
+	}
 }
 
 void FImGuiModuleManager::CreateTickInitializer()
@@ -194,11 +289,154 @@ void FImGuiModuleManager::Tick(float DeltaSeconds)
 		// Update context manager to advance all ImGui contexts to the next frame.
 		ContextManager.Tick(DeltaSeconds);
 
+		// Exchange new frames and input with remote server or viewer.
+		TickRemote();
+
 		// Inform that we finished updating ImGui, so other subsystems can react.
 		PostImGuiUpdateEvent.Broadcast();
 	}
 }
 
+bool FImGuiModuleManager::TickCoreTicker(float DeltaSeconds)
+{
+	Tick(DeltaSeconds);
+	return true;
+}
+
+void FImGuiModuleManager::UpdateRemoteServer()
+{
+	if (Settings.ShouldStartRemoteServer())
+	{
+#if WITH_EDITOR
+		const int32 ContextIndex = GIsEditor ? Utilities::EDITOR_CONTEXT_INDEX : Utilities::STANDALONE_GAME_CONTEXT_INDEX;
+#else
+		const int32 ContextIndex = Utilities::STANDALONE_GAME_CONTEXT_INDEX;
+#endif
+		StartRemoteServer(ContextIndex, Settings.GetRemoteServerPort());
+	}
+	else
+	{
+		StopRemoteServer();
+	}
+}
+
+void FImGuiModuleManager::StartRemoteServer(int32 ContextIndex, int32 Port)
+{
+	if (!RemoteServer || RemoteServer->GetContextIndex() != ContextIndex || RemoteServer->GetPort() != Port)
+	{
+		StopRemoteServer();
+		RemoteServer = FImGuiRemoteServer::Create(ContextManager, ContextIndex, Port);
+	}
+}
+
+void FImGuiModuleManager::StopRemoteServer()
+{
+	RemoteServer.Reset();
+}
+
+void FImGuiModuleManager::TickRemote()
+{
+	if (RemoteServer)
+	{
+		RemoteServer->Tick();
+	}
+
+	if (RemoteClient)
+	{
+		FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(RemoteClientContextIndex);
+		if (!ContextProxy || !RemoteClient->Tick(*ContextProxy))
+		{
+			DisconnectRemoteImpl();
+		}
+	}
+}
+
+void FImGuiModuleManager::StartRemoteServerImpl(const TArray<FString>& Args, UWorld* World)
+{
+	if (World)
+	{
+		int32 ContextIndex;
+		ContextManager.GetWorldContextProxy(*World, ContextIndex);
+
+		int32 Port = IMGUI_REMOTE_DEFAULT_PORT;
+		if (Args.Num() > 0)
+		{
+			LexFromString(Port, *Args[0]);
+		}
+
+		StartRemoteServer(ContextIndex, Port);
+	}
+}
+
+void FImGuiModuleManager::StopRemoteServerImpl()
+{
+	StopRemoteServer();
+}
+
+void FImGuiModuleManager::ConnectRemoteImpl(const TArray<FString>& Args, UWorld* World)
+{
+	if (World && FSlateApplication::IsInitialized())
+	{
+		DisconnectRemoteImpl();
+
+		FImGuiContextProxy& ContextProxy = ContextManager.GetWorldContextProxy(*World, RemoteClientContextIndex);
+
+		const FString Address = (Args.Num() > 0) ? Args[0] : TEXT("127.0.0.1");
+		int32 Port = IMGUI_REMOTE_DEFAULT_PORT;
+		if (Args.Num() > 1)
+		{
+			LexFromString(Port, *Args[1]);
+		}
+
+		// Make sure that plain texture exists, as it is used for textures not transferred by the server.
+		LoadTextures();
+
+		RemoteClient = FImGuiRemoteClient::Create(TextureManager, Address, Port);
+		if (RemoteClient)
+		{
+			ContextProxy.SetDrawDataSource(RemoteClient);
+		}
+	}
+}
+
+void FImGuiModuleManager::DisconnectRemoteImpl()
+{
+	if (RemoteClient)
+	{
+		if (FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(RemoteClientContextIndex))
+		{
+			ContextProxy->SetDrawDataSource(nullptr);
+		}
+		RemoteClient.Reset();
+	}
+}
+
+void FImGuiModuleManager::PrintRemoteStatsImpl()
+{
+	if (RemoteServer)
+	{
+		if (const FImGuiRemoteConnection* Connection = RemoteServer->GetConnection())
+		{
+			UE_LOG(LogImGuiRemote, Display, TEXT("Remote server (port %d): frames sent = %d, frames skipped = %d, sent = %lld KB (%lld KB/s), received = %lld KB (%lld KB/s), pending = %d B"),
+				RemoteServer->GetPort(), RemoteServer->GetNumFramesSent(), RemoteServer->GetNumFramesSkipped(),
+				Connection->GetBytesSent() / 1024, Connection->GetSendRate() / 1024,
+				Connection->GetBytesReceived() / 1024, Connection->GetReceiveRate() / 1024, Connection->GetPendingBytes());
+		}
+		else
+		{
+			UE_LOG(LogImGuiRemote, Display, TEXT("Remote server (port %d): waiting for viewer"), RemoteServer->GetPort());
+		}
+	}
+
+	if (RemoteClient)
+	{
+		const FImGuiRemoteConnection& Connection = RemoteClient->GetConnection();
+		UE_LOG(LogImGuiRemote, Display, TEXT("Remote viewer: frames received = %d, received = %lld KB (%lld KB/s), sent = %lld KB (%lld KB/s)"),
+			RemoteClient->GetNumFramesReceived(), Connection.GetBytesReceived() / 1024, Connection.GetReceiveRate() / 1024,
+			Connection.GetBytesSent() / 1024, Connection.GetSendRate() / 1024);
+	}
+}
+
 void FImGuiModuleManager::OnViewportCreated()
 {
 	checkf(FSlateApplication::IsInitialized(), TEXT("We expect Slate to be initialized when game viewport is created."));
@@ -259,4 +497,5 @@ void FImGuiModuleManager::AddWidgetsToActiveViewports()
 void FImGuiModuleManager::OnContextProxyCreated(int32 ContextIndex, FImGuiContextProxy& ContextProxy)
 {
 	ContextProxy.OnDraw().AddLambda([this, ContextIndex]() { ImGuiDemo.DrawControls(ContextIndex); });
+	ContextProxy.OnDraw().AddRaw(&ImGuiLog, &FImGuiLog::DrawControls);
 }
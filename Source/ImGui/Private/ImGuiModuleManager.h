@@ -26,12 +26,18 @@
 
 #include "ImGuiContextManager.h"
 #include "ImGuiDemo.h"
+#include "ImGuiLog.h"
 #include "ImGuiModuleCommands.h"
 #include "ImGuiModuleProperties.h"
 #include "ImGuiModuleSettings.h"
+#include "ImGuiRemote.h"
 #include "TextureManager.h"
+#include "VersionCompatibility.h"
 #include "Widgets/SImGuiLayout.h"
 
+#include <Containers/Ticker.h>
+#include <HAL/IConsoleManager.h>
+
 
 // Central manager that implements module logic. It initializes and controls remaining module components.
 class FImGuiModuleManager
@@ -72,7 +78,11 @@ private:
 	void LoadTextures();
 	void BuildFontAtlasTexture();
 
-	bool IsTickRegistered() { return TickDelegateHandle.IsValid(); }
+	// Texture functions for ImPlot (see ImPlot::SetTextureFunctions).
+	static ImTextureID UpdatePlotTexture(ImTextureID Texture, const ImU32* Pixels, int Width, int Height, void* UserData);
+	static void ReleasePlotTexture(ImTextureID Texture, void* UserData);
+
+	bool IsTickRegistered() { return TickDelegateHandle.IsValid() || CoreTickerHandle.IsValid(); }
 	void RegisterTick();
 	void UnregisterTick();
 
@@ -80,6 +90,18 @@ private:
 	void ReleaseTickInitializer();
 
 	void Tick(float DeltaSeconds);
+	bool TickCoreTicker(float DeltaSeconds);
+
+	void UpdateRemoteServer();
+	void StartRemoteServer(int32 ContextIndex, int32 Port);
+	void StopRemoteServer();
+	void TickRemote();
+
+	void StartRemoteServerImpl(const TArray<FString>& Args, UWorld* World);
+	void StopRemoteServerImpl();
+	void ConnectRemoteImpl(const TArray<FString>& Args, UWorld* World);
+	void DisconnectRemoteImpl();
+	void PrintRemoteStatsImpl();
 
 	void OnViewportCreated();
 
@@ -103,18 +125,43 @@ private:
 	// Widget that we add to all created contexts to draw ImGui demo. 
 	FImGuiDemo ImGuiDemo;
 
+	// Log output device with a window that we add to all created contexts.
+	FImGuiLog ImGuiLog;
+
 	// Manager for ImGui contexts.
 	FImGuiContextManager ContextManager;
 
 	// Manager for textures resources.
 	FTextureManager TextureManager;
 
+	// Counter used to give unique names to textures created for ImPlot.
+	int32 PlotTextureCounter = 0;
+
 	// Slate widgets that we created.
 	TArray<TWeakPtr<SImGuiLayout>> Widgets;
 
+	// Server streaming a context to a remote viewer.
+	TUniquePtr<FImGuiRemoteServer> RemoteServer;
+
+	// Viewer presenting output of a remote server in a local context.
+	TSharedPtr<FImGuiRemoteClient> RemoteClient;
+	int32 RemoteClientContextIndex = 0;
+
+	FAutoConsoleCommandWithWorldAndArgs StartRemoteServerCommand;
+	FAutoConsoleCommand StopRemoteServerCommand;
+	FAutoConsoleCommandWithWorldAndArgs ConnectRemoteCommand;
+	FAutoConsoleCommand DisconnectRemoteCommand;
+	FAutoConsoleCommand PrintRemoteStatsCommand;
+
 	FDelegateHandle TickInitializerHandle;
 	FDelegateHandle TickDelegateHandle;
 	FDelegateHandle ViewportCreatedHandle;
 
+#if ENGINE_COMPATIBILITY_LEGACY_CORE_TICKER
+	FDelegateHandle CoreTickerHandle;
+#else
+	FTSTicker::FDelegateHandle CoreTickerHandle;
+#endif
+
 	bool bTexturesLoaded = false;
 };
@@ -151,6 +151,10 @@ void FImGuiModuleSettings::UpdateSettings()
 		SetUseSoftwareCursor(SettingsObject->bUseSoftwareCursor);
 		SetToggleInputKey(SettingsObject->ToggleInput);
 		SetCanvasSizeInfo(SettingsObject->CanvasSize);
+		SetUpdateRate(SettingsObject->UpdateRate);
+		SetComposeInRenderTarget(SettingsObject->bComposeInRenderTarget);
+		SetUseCustomSlateElement(SettingsObject->bUseCustomSlateElement);
+		SetRemoteServer(SettingsObject->bStartRemoteServer, SettingsObject->RemoteServerPort);
 	}
 }
 
@@ -231,6 +235,43 @@ void FImGuiModuleSettings::SetDPIScaleInfo(const FImGuiDPIScaleInfo& ScaleInfo)
 	OnDPIScaleChangedDelegate.Broadcast(DPIScale);
 }
 
+void FImGuiModuleSettings::SetUpdateRate(float Rate)
+{
+	if (UpdateRate != Rate)
+	{
+		UpdateRate = Rate;
+		OnUpdateRateChangedDelegate.Broadcast(Rate);
+	}
+}
+
+void FImGuiModuleSettings::SetComposeInRenderTarget(bool bCompose)
+{
+	if (bComposeInRenderTarget != bCompose)
+	{
+		bComposeInRenderTarget = bCompose;
+		OnComposeInRenderTargetChangedDelegate.Broadcast(bCompose);
+	}
+}
+
+void FImGuiModuleSettings::SetUseCustomSlateElement(bool bUse)
+{
+	if (bUseCustomSlateElement != bUse)
+	{
+		bUseCustomSlateElement = bUse;
+		OnUseCustomSlateElementChangedDelegate.Broadcast(bUse);
+	}
+}
+
+void FImGuiModuleSettings::SetRemoteServer(bool bStart, int32 Port)
+{
+	if (bStartRemoteServer != bStart || RemoteServerPort != Port)
+	{
+		bStartRemoteServer = bStart;
+		RemoteServerPort = Port;
+		OnRemoteServerChangedDelegate.Broadcast();
+	}
+}
+
 #if WITH_EDITOR
 
 void FImGuiModuleSettings::OnPropertyChanged(class UObject* ObjectBeingModified, struct FPropertyChangedEvent& PropertyChangedEvent)
@@ -240,6 +240,33 @@ protected:
 	UPROPERTY(EditAnywhere, config, Category = "DPI Scale", Meta = (ShowOnlyInnerProperties))
 	FImGuiDPIScaleInfo DPIScale;
 
+	// Target number of ImGui updates per second. Zero (default) means that contexts are updated in every frame. Between
+	// updates, the last output is presented again and input is queued for the next update. Debug delegates are not
+	// called and output drawn directly from other places (like actor ticks) is discarded.
+	UPROPERTY(EditAnywhere, config, Category = "Performance", meta = (ClampMin = 0, UIMin = 0, UIMax = 120))
+	float UpdateRate = 0.f;
+
+	// Whether to render ImGui output into a render target presented as a single textured quad. Only areas covered by
+	// draw lists that changed since the last update are redrawn, so painting mostly static output costs the same
+	// regardless of its complexity. Note that changes in texture content are only picked up in redrawn areas.
+	UPROPERTY(EditAnywhere, config, Category = "Performance")
+	bool bComposeInRenderTarget = false;
+
+	// Whether to draw ImGui output with a custom Slate element and dedicated shaders. Vertices are uploaded in ImGui
+	// format and transformed on GPU, so there is no conversion to Slate vertices. Ignored when composing in a render
+	// target.
+	UPROPERTY(EditAnywhere, config, Category = "Performance")
+	bool bUseCustomSlateElement = false;
+
+	// Whether to start a server streaming ImGui output to a remote viewer (see ImGui.Remote console commands). Without
+	// viewports (e.g. on dedicated servers), this is the only way to interact with ImGui.
+	UPROPERTY(EditAnywhere, config, Category = "Remote")
+	bool bStartRemoteServer = false;
+
+	// Port on which the remote server listens. Only local connections are accepted.
+	UPROPERTY(EditAnywhere, config, Category = "Remote", meta = (ClampMin = 1, ClampMax = 65535))
+	int32 RemoteServerPort = 7780;
+
 	static UImGuiSettings* DefaultInstance;
 
 	friend class FImGuiModuleSettings;
@@ -261,6 +288,7 @@ public:
 	DECLARE_MULTICAST_DELEGATE_OneParam(FStringClassReferenceChangeDelegate, const FSoftClassPath&);
 	DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiCanvasSizeInfoChangeDelegate, const FImGuiCanvasSizeInfo&);
 	DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiDPIScaleInfoChangeDelegate, const FImGuiDPIScaleInfo&);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FFloatChangeDelegate, float);
 
 	// Constructor for ImGui module settings. It will bind to instances of module properties and commands and will
 	// update them every time when settings are changed.
@@ -289,6 +317,21 @@ public:
 	// Get the DPI Scale information.
 	const FImGuiDPIScaleInfo& GetDPIScaleInfo() const { return DPIScale; }
 
+	// Get the target number of ImGui updates per second (zero means every frame).
+	float GetUpdateRate() const { return UpdateRate; }
+
+	// Whether ImGui output should be composed in a render target.
+	bool ShouldComposeInRenderTarget() const { return bComposeInRenderTarget; }
+
+	// Whether ImGui output should be drawn with a custom Slate element.
+	bool ShouldUseCustomSlateElement() const { return bUseCustomSlateElement; }
+
+	// Whether remote server should be started.
+	bool ShouldStartRemoteServer() const { return bStartRemoteServer; }
+
+	// Get the port on which remote server should listen.
+	int32 GetRemoteServerPort() const { return RemoteServerPort; }
+
 	// Delegate raised when ImGui Input Handle is changed.
 	FStringClassReferenceChangeDelegate OnImGuiInputHandlerClassChanged;
 
@@ -301,6 +344,18 @@ public:
 	// Delegate raised when the DPI scale is changed.
 	FImGuiDPIScaleInfoChangeDelegate OnDPIScaleChangedDelegate;
 
+	// Delegate raised when the target update rate is changed.
+	FFloatChangeDelegate OnUpdateRateChangedDelegate;
+
+	// Delegate raised when render target composition is enabled or disabled.
+	FBoolChangeDelegate OnComposeInRenderTargetChangedDelegate;
+
+	// Delegate raised when drawing with a custom Slate element is enabled or disabled.
+	FBoolChangeDelegate OnUseCustomSlateElementChangedDelegate;
+
+	// Delegate raised when remote server settings are changed.
+	FSimpleMulticastDelegate OnRemoteServerChangedDelegate;
+
 private:
 
 	void InitializeAllSettings();
@@ -315,6 +370,10 @@ private:
 	void SetToggleInputKey(const FImGuiKeyInfo& KeyInfo);
 	void SetCanvasSizeInfo(const FImGuiCanvasSizeInfo& CanvasSizeInfo);
 	void SetDPIScaleInfo(const FImGuiDPIScaleInfo& ScaleInfo);
+	void SetUpdateRate(float Rate);
+	void SetComposeInRenderTarget(bool bCompose);
+	void SetUseCustomSlateElement(bool bUse);
+	void SetRemoteServer(bool bStart, int32 Port);
 
 #if WITH_EDITOR
 	void OnPropertyChanged(class UObject* ObjectBeingModified, struct FPropertyChangedEvent& PropertyChangedEvent);
@@ -331,4 +390,9 @@ private:
 	bool bShareGamepadInput = false;
 	bool bShareMouseInput = false;
 	bool bUseSoftwareCursor = false;
+	float UpdateRate = 0.f;
+	bool bComposeInRenderTarget = false;
+	bool bUseCustomSlateElement = false;
+	bool bStartRemoteServer = false;
+	int32 RemoteServerPort = 0;
 };
@@ -0,0 +1,425 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ImGuiObjectInspector.h"
+
+#include "VersionCompatibility.h"
+
+#include <UObject/UnrealType.h>
+
+
+namespace
+{
+	// Cached values that were not drawn for this number of frames are released.
+	constexpr int32 UnusedValueFrames = 60;
+
+	// Longer values are truncated.
+	constexpr int32 MaxValueLength = 256;
+
+	constexpr ImGuiTreeNodeFlags LeafNodeFlags = ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen
+		| ImGuiTreeNodeFlags_Bullet | ImGuiTreeNodeFlags_SpanFullWidth;
+
+	// Start a table row with a tree node in the first column and move to the value column.
+	bool BeginRow(const char* Label, ImGuiTreeNodeFlags Flags = ImGuiTreeNodeFlags_SpanFullWidth)
+	{
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		const bool bOpen = ImGui::TreeNodeEx(Label, Flags);
+		ImGui::TableNextColumn();
+		return bOpen;
+	}
+
+	int32 GetArrayDim(const FProperty* Property)
+	{
+#if FROM_ENGINE_VERSION(5, 5)
+		return Property->GetArrayDim();
+#else
+		return Property->ArrayDim;
+#endif
+	}
+}
+
+FImGuiObjectInspector::FImGuiObjectInspector(float InRefreshRate)
+{
+	SetRefreshRate(InRefreshRate);
+}
+
+void FImGuiObjectInspector::Draw(UObject* Object)
+{
+	if (Object)
+	{
+		ImGui::PushID(Object);
+		Draw(Object->GetClass(), Object, TCHAR_TO_UTF8(*Object->GetName()));
+		ImGui::PopID();
+	}
+}
+
+void FImGuiObjectInspector::Draw(const UStruct* Struct, const void* Data, const char* Label)
+{
+	check(Struct);
+	check(Data);
+
+	CurrentTime = ImGui::GetTime();
+	CurrentFrame = ImGui::GetFrameCount();
+	PruneValues();
+
+	if (ImGui::BeginTable("##Inspector", 2, ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_RowBg))
+	{
+		ImGui::TableSetupColumn("Property");
+		ImGui::TableSetupColumn("Value");
+
+		if (BeginRow(Label, ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_DefaultOpen))
+		{
+			DrawStruct(Struct, Data);
+			ImGui::TreePop();
+		}
+
+		ImGui::EndTable();
+	}
+}
+
+void FImGuiObjectInspector::Reset()
+{
+	Layouts.Reset();
+	Values.Reset();
+}
+
+FImGuiObjectInspector::EPropertyKind FImGuiObjectInspector::GetKind(const FProperty* Property)
+{
+	if (Property->IsA<FStructProperty>())
+	{
+		return EPropertyKind::Struct;
+	}
+	if (Property->IsA<FObjectPropertyBase>())
+	{
+		return EPropertyKind::Object;
+	}
+	if (Property->IsA<FArrayProperty>())
+	{
+		return EPropertyKind::Array;
+	}
+	if (Property->IsA<FSetProperty>())
+	{
+		return EPropertyKind::Set;
+	}
+	if (Property->IsA<FMapProperty>())
+	{
+		return EPropertyKind::Map;
+	}
+	return EPropertyKind::Value;
+}
+
+const FImGuiObjectInspector::FStructLayout& FImGuiObjectInspector::GetLayout(const UStruct* Struct)
+{
+	// Recompiling blueprints reuses their classes but destroys and relinks properties, so layouts that were collected
+	// before relinking are rebuilt.
+	TUniquePtr<FStructLayout>& Layout = Layouts.FindOrAdd(Struct);
+	if (!Layout || Layout->PropertyLink != Struct->PropertyLink)
+	{
+		Layout = MakeUnique<FStructLayout>();
+		Layout->PropertyLink = Struct->PropertyLink;
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const FTCHARToUTF8 Name(*It->GetName());
+
+			FPropertyLayout& PropertyLayout = Layout->Properties.AddDefaulted_GetRef();
+			PropertyLayout.Property = *It;
+			PropertyLayout.Name.Append(Name.Get(), Name.Length());
+			PropertyLayout.Name.Add('\0');
+			PropertyLayout.Kind = GetKind(*It);
+		}
+	}
+	return *Layout;
+}
+
+FImGuiObjectInspector::FCachedValue& FImGuiObjectInspector::GetCachedValue(ImGuiID Id, bool& bOutNeedsUpdate)
+{
+	FCachedValue* Value = Values.Find(Id);
+	if (Value)
+	{
+		bOutNeedsUpdate = (RefreshRate <= 0.f) || (CurrentTime - Value->UpdateTime >= 1.0 / RefreshRate);
+	}
+	else
+	{
+		Value = &Values.Add(Id);
+		bOutNeedsUpdate = true;
+	}
+
+	if (bOutNeedsUpdate)
+	{
+		Value->UpdateTime = CurrentTime;
+	}
+	Value->LastUsedFrame = CurrentFrame;
+
+	return *Value;
+}
+
+const char* FImGuiObjectInspector::GetValueText(ImGuiID Id, const FProperty* Property, const void* ValuePtr)
+{
+	bool bNeedsUpdate = false;
+	FCachedValue& Value = GetCachedValue(Id, bNeedsUpdate);
+	if (bNeedsUpdate)
+	{
+		FString Text;
+#if ENGINE_COMPATIBILITY_LEGACY_EXPORT_TEXT_ITEM
+		Property->ExportTextItem(Text, ValuePtr, nullptr, nullptr, PPF_None);
+#else
+		Property->ExportTextItem_Direct(Text, ValuePtr, nullptr, nullptr, PPF_None);
+#endif
+		Text.LeftInline(MaxValueLength);
+
+		const FTCHARToUTF8 ConvertedText(*Text);
+		Value.Text.Reset();
+		Value.Text.Append(ConvertedText.Get(), ConvertedText.Length());
+		Value.Text.Add('\0');
+	}
+	return Value.Text.GetData();
+}
+
+const TArray<int32>& FImGuiObjectInspector::GetElementIndices(ImGuiID Id, int32 NumElements, int32 MaxIndex,
+	TFunctionRef<bool(int32)> IsValidIndex)
+{
+	bool bNeedsUpdate = false;
+	FCachedValue& Value = GetCachedValue(Id, bNeedsUpdate);
+
+	// Indices are also updated when the number of elements changes, but callers still need to validate them.
+	if (bNeedsUpdate || Value.ElementIndices.Num() != NumElements)
+	{
+		Value.ElementIndices.Reset(NumElements);
+		for (int32 Index = 0; Index < MaxIndex; Index++)
+		{
+			if (IsValidIndex(Index))
+			{
+				Value.ElementIndices.Add(Index);
+			}
+		}
+	}
+	return Value.ElementIndices;
+}
+
+void FImGuiObjectInspector::PruneValues()
+{
+	if (CurrentFrame - LastPruneFrame >= UnusedValueFrames)
+	{
+		LastPruneFrame = CurrentFrame;
+		for (auto It = Values.CreateIterator(); It; ++It)
+		{
+			if (CurrentFrame - It.Value().LastUsedFrame >= UnusedValueFrames)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void FImGuiObjectInspector::DrawStruct(const UStruct* Struct, const void* Data)
+{
+	for (const FPropertyLayout& PropertyLayout : GetLayout(Struct).Properties)
+	{
+		const FProperty* Property = PropertyLayout.Property;
+		const int32 ArrayDim = GetArrayDim(Property);
+		if (ArrayDim == 1)
+		{
+			DrawProperty(Property, PropertyLayout.Kind, PropertyLayout.Name.GetData(), Property->ContainerPtrToValuePtr<void>(Data));
+		}
+		else
+		{
+			const bool bOpen = BeginRow(PropertyLayout.Name.GetData());
+			ImGui::TextDisabled("%d elements", ArrayDim);
+			if (bOpen)
+			{
+				char ElementLabel[32];
+				for (int32 Index = 0; Index < ArrayDim; Index++)
+				{
+					FCStringAnsi::Snprintf(ElementLabel, sizeof(ElementLabel), "[%d]", Index);
+					DrawProperty(Property, PropertyLayout.Kind, ElementLabel, Property->ContainerPtrToValuePtr<void>(Data, Index));
+				}
+				ImGui::TreePop();
+			}
+		}
+	}
+}
+
+void FImGuiObjectInspector::DrawProperty(const FProperty* Property, EPropertyKind Kind, const char* Label, const void* ValuePtr)
+{
+	switch (Kind)
+	{
+	case EPropertyKind::Value:
+		DrawValue(Property, Label, ValuePtr);
+		break;
+
+	case EPropertyKind::Struct:
+	{
+		const UScriptStruct* Struct = CastFieldChecked<FStructProperty>(Property)->Struct;
+		const bool bOpen = BeginRow(Label);
+		ImGui::TextDisabled("%s", TCHAR_TO_UTF8(*Struct->GetName()));
+		if (bOpen)
+		{
+			DrawStruct(Struct, ValuePtr);
+			ImGui::TreePop();
+		}
+		break;
+	}
+
+	case EPropertyKind::Object:
+		DrawObject(Property, Label, ValuePtr);
+		break;
+
+	case EPropertyKind::Array:
+		DrawArray(Property, Label, ValuePtr);
+		break;
+
+	case EPropertyKind::Set:
+		DrawSet(Property, Label, ValuePtr);
+		break;
+
+	case EPropertyKind::Map:
+		DrawMap(Property, Label, ValuePtr);
+		break;
+	}
+}
+
+void FImGuiObjectInspector::DrawValue(const FProperty* Property, const char* Label, const void* ValuePtr)
+{
+	BeginRow(Label, LeafNodeFlags);
+	ImGui::TextUnformatted(GetValueText(ImGui::GetID(Label), Property, ValuePtr));
+}
+
+void FImGuiObjectInspector::DrawObject(const FProperty* Property, const char* Label, const void* ValuePtr)
+{
+	UObject* Object = CastFieldChecked<FObjectPropertyBase>(Property)->GetObjectPropertyValue(ValuePtr);
+	if (!Object)
+	{
+		BeginRow(Label, LeafNodeFlags);
+		ImGui::TextDisabled("None");
+		return;
+	}
+
+	const bool bOpen = BeginRow(Label);
+	ImGui::TextUnformatted(GetValueText(ImGui::GetID(Label), Property, ValuePtr));
+	if (bOpen)
+	{
+		DrawStruct(Object->GetClass(), Object);
+		ImGui::TreePop();
+	}
+}
+
+void FImGuiObjectInspector::DrawArray(const FProperty* Property, const char* Label, const void* ValuePtr)
+{
+	const FArrayProperty* ArrayProperty = CastFieldChecked<FArrayProperty>(Property);
+	FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+
+	const bool bOpen = BeginRow(Label);
+	ImGui::TextDisabled("%d elements", Helper.Num());
+	if (bOpen)
+	{
+		const EPropertyKind InnerKind = GetKind(ArrayProperty->Inner);
+		char ElementLabel[32];
+
+		// Only visible elements are evaluated.
+		ImGuiListClipper Clipper;
+		Clipper.Begin(Helper.Num());
+		while (Clipper.Step())
+		{
+			for (int32 Index = Clipper.DisplayStart; Index < Clipper.DisplayEnd; Index++)
+			{
+				FCStringAnsi::Snprintf(ElementLabel, sizeof(ElementLabel), "[%d]", Index);
+				DrawProperty(ArrayProperty->Inner, InnerKind, ElementLabel, Helper.GetRawPtr(Index));
+			}
+		}
+		ImGui::TreePop();
+	}
+}
+
+void FImGuiObjectInspector::DrawSet(const FProperty* Property, const char* Label, const void* ValuePtr)
+{
+	const FSetProperty* SetProperty = CastFieldChecked<FSetProperty>(Property);
+	FScriptSetHelper Helper(SetProperty, ValuePtr);
+
+	const bool bOpen = BeginRow(Label);
+	ImGui::TextDisabled("%d elements", Helper.Num());
+	if (bOpen)
+	{
+		// Set storage is sparse, so valid indices are cached to map rows to elements.
+		const TArray<int32>& Indices = GetElementIndices(ImGui::GetID("##Indices"), Helper.Num(), Helper.GetMaxIndex(),
+			[&Helper](int32 Index) { return Helper.IsValidIndex(Index); });
+
+		const EPropertyKind ElementKind = GetKind(SetProperty->ElementProp);
+		char ElementLabel[32];
+
+		ImGuiListClipper Clipper;
+		Clipper.Begin(Indices.Num());
+		while (Clipper.Step())
+		{
+			for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+			{
+				if (Helper.IsValidIndex(Indices[Row]))
+				{
+					FCStringAnsi::Snprintf(ElementLabel, sizeof(ElementLabel), "[%d]", Row);
+					DrawProperty(SetProperty->ElementProp, ElementKind, ElementLabel, Helper.GetElementPtr(Indices[Row]));
+				}
+			}
+		}
+		ImGui::TreePop();
+	}
+}
+
+void FImGuiObjectInspector::DrawMap(const FProperty* Property, const char* Label, const void* ValuePtr)
+{
+	const FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Property);
+	FScriptMapHelper Helper(MapProperty, ValuePtr);
+
+	const bool bOpen = BeginRow(Label);
+	ImGui::TextDisabled("%d elements", Helper.Num());
+	if (bOpen)
+	{
+		// Map storage is sparse, so valid indices are cached to map rows to pairs.
+		const TArray<int32>& Indices = GetElementIndices(ImGui::GetID("##Indices"), Helper.Num(), Helper.GetMaxIndex(),
+			[&Helper](int32 Index) { return Helper.IsValidIndex(Index); });
+
+		const EPropertyKind ValueKind = GetKind(MapProperty->ValueProp);
+		char PairLabel[MaxValueLength * 4 + 16];
+
+		ImGuiListClipper Clipper;
+		Clipper.Begin(Indices.Num());
+		while (Clipper.Step())
+		{
+			for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+			{
+				const int32 Index = Indices[Row];
+				if (Helper.IsValidIndex(Index))
+				{
+					// Pairs are labeled with keys, with row index keeping labels unique.
+					ImGui::PushID(Row);
+					const char* KeyText = GetValueText(ImGui::GetID("##Key"), MapProperty->KeyProp, Helper.GetKeyPtr(Index));
+					ImGui::PopID();
+
+					FCStringAnsi::Snprintf(PairLabel, sizeof(PairLabel), "%s##%d", KeyText, Row);
+					DrawProperty(MapProperty->ValueProp, ValueKind, PairLabel, Helper.GetValuePtr(Index));
+				}
+			}
+		}
+		ImGui::TreePop();
+	}
+}
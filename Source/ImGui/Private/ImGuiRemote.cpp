@@ -0,0 +1,705 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ImGuiRemote.h"
+
+#include "ImGuiContextManager.h"
+#include "ImGuiContextProxy.h"
+#include "ImGuiInteroperability.h"
+#include "ImGuiModuleDebug.h"
+
+#include <Common/TcpSocketBuilder.h>
+#include <HAL/PlatformTime.h>
+#include <Interfaces/IPv4/IPv4Endpoint.h>
+#include <Misc/Compression.h>
+#include <Sockets.h>
+#include <SocketSubsystem.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+
+DEFINE_LOG_CATEGORY(LogImGuiRemote);
+
+namespace
+{
+	enum ERemoteMessage : uint32
+	{
+		// Server to client.
+		RemoteMessage_FontAtlas = 1,
+		RemoteMessage_Frame = 2,
+
+		// Client to server.
+		RemoteMessage_Input = 16,
+		RemoteMessage_DisplaySize = 17,
+		RemoteMessage_KeyFrameRequest = 18,
+	};
+
+	struct FMessageHeader
+	{
+		uint32 Type;
+		uint32 Size;
+	};
+
+	// Font atlases received from the remote server can't be bigger than this in any dimension.
+	constexpr int32 MaxFontAtlasSize = 8192;
+
+	struct FFontAtlasHeader
+	{
+		int32 TextureId;
+		int32 Width;
+		int32 Height;
+		int32 RawSize;
+	};
+
+	// Input event in transport format. Meaning of fields depends on the event type:
+	// MousePos, MouseWheel: X, Y; MouseButton: Code = button, X = down; Key: Code = key, X = down, Y = analog value;
+	// Text: Code = character; Focus: Code = focused.
+	struct FInputEvent
+	{
+		int32 Type;
+		int32 Code;
+		float X;
+		float Y;
+	};
+
+	// Don't queue more frames if viewer is that much behind.
+	constexpr int32 MaxPendingBytes = 4 * 1024 * 1024;
+
+	// Give up if connection with the server is not established in that time.
+	constexpr double ConnectTimeout = 5.0;
+
+	void AppendBytes(TArray<uint8>& OutBuffer, const void* Data, int32 Size)
+	{
+		OutBuffer.Append(static_cast<const uint8*>(Data), Size);
+	}
+
+	void RemoveFront(TArray<uint8>& Buffer, int32 Count)
+	{
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4)
+		Buffer.RemoveAt(0, Count, EAllowShrinking::No);
+#else
+		Buffer.RemoveAt(0, Count, false);
+#endif
+	}
+
+	bool IsWouldBlock()
+	{
+		return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK;
+	}
+
+	bool IsConnectInProgress()
+	{
+		const ESocketErrors Error = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+		return Error == SE_EWOULDBLOCK || Error == SE_EINPROGRESS;
+	}
+
+	void DestroySocket(FSocket* Socket)
+	{
+		if (Socket)
+		{
+			Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		}
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// Connection
+//----------------------------------------------------------------------------------------------------
+
+FImGuiRemoteConnection::FImGuiRemoteConnection(FSocket* InSocket)
+	: Socket(InSocket)
+	, RateStartTime(FPlatformTime::Seconds())
+{
+}
+
+FImGuiRemoteConnection::~FImGuiRemoteConnection()
+{
+	DestroySocket(Socket);
+}
+
+void FImGuiRemoteConnection::Send(uint32 Type, const TArray<uint8>& Payload)
+{
+	const FMessageHeader Header{ Type, static_cast<uint32>(Payload.Num()) };
+	AppendBytes(SendBuffer, &Header, sizeof(Header));
+	SendBuffer.Append(Payload);
+}
+
+bool FImGuiRemoteConnection::Update()
+{
+	if (bIsBroken)
+	{
+		return false;
+	}
+
+	// Send as much as socket accepts without blocking.
+	if (SendBuffer.Num() > 0)
+	{
+		int32 Sent = 0;
+		if (!Socket->Send(SendBuffer.GetData(), SendBuffer.Num(), Sent) && !IsWouldBlock())
+		{
+			return false;
+		}
+
+		if (Sent > 0)
+		{
+			RemoveFront(SendBuffer, Sent);
+			BytesSent += Sent;
+		}
+	}
+
+	// Receive everything that is pending.
+	uint32 PendingSize = 0;
+	bool bReceived = false;
+	while (Socket->HasPendingData(PendingSize) && PendingSize > 0)
+	{
+		const int32 Offset = ReceiveBuffer.AddUninitialized(PendingSize);
+		int32 Read = 0;
+		const bool bSuccess = Socket->Recv(ReceiveBuffer.GetData() + Offset, PendingSize, Read);
+		ReceiveBuffer.SetNum(Offset + Read);
+		if (!bSuccess)
+		{
+			return false;
+		}
+
+		BytesReceived += Read;
+		bReceived = true;
+	}
+
+	// Without pending data, peek to detect whether the other side closed the connection.
+	if (!bReceived)
+	{
+		uint8 Byte;
+		int32 Read = 0;
+		if (Socket->Recv(&Byte, 1, Read, ESocketReceiveFlags::Peek) ? Read == 0 : !IsWouldBlock())
+		{
+			return false;
+		}
+	}
+
+	UpdateRates();
+
+	return Socket->GetConnectionState() != SCS_ConnectionError;
+}
+
+bool FImGuiRemoteConnection::PopMessage(uint32& OutType, TArray<uint8>& OutPayload)
+{
+	const int32 Available = ReceiveBuffer.Num() - ReceiveOffset;
+	if (Available < static_cast<int32>(sizeof(FMessageHeader)))
+	{
+		return false;
+	}
+
+	FMessageHeader Header;
+	FMemory::Memcpy(&Header, ReceiveBuffer.GetData() + ReceiveOffset, sizeof(Header));
+
+	// Header comes from the network, so size needs to be validated before waiting for the payload. Stream can't be
+	// resynchronised after a malformed message, so the connection is dropped on the next update.
+	if (Header.Size > MaxMessageSize)
+	{
+		UE_LOG(LogImGuiRemote, Error, TEXT("Rejected ImGui remote message with invalid size %u B (type %u)."), Header.Size, Header.Type);
+		bIsBroken = true;
+		ReceiveBuffer.Empty();
+		ReceiveOffset = 0;
+		return false;
+	}
+
+	if (Available - static_cast<int64>(sizeof(Header)) < Header.Size)
+	{
+		return false;
+	}
+
+	const uint8* Payload = ReceiveBuffer.GetData() + ReceiveOffset + sizeof(Header);
+	OutType = Header.Type;
+	OutPayload.Reset();
+	OutPayload.Append(Payload, Header.Size);
+
+	ReceiveOffset += sizeof(Header) + Header.Size;
+
+	// Compact buffer once all data are consumed or when consumed part is big enough.
+	if (ReceiveOffset == ReceiveBuffer.Num() || ReceiveOffset > ReceiveBuffer.Num() / 2)
+	{
+		RemoveFront(ReceiveBuffer, ReceiveOffset);
+		ReceiveOffset = 0;
+	}
+
+	return true;
+}
+
+ESocketConnectionState FImGuiRemoteConnection::GetConnectionState() const
+{
+	return Socket->GetConnectionState();
+}
+
+void FImGuiRemoteConnection::UpdateRates()
+{
+	const double Time = FPlatformTime::Seconds();
+	const double Elapsed = Time - RateStartTime;
+	if (Elapsed >= 1.0)
+	{
+		SendRate = static_cast<int64>((BytesSent - BytesSentAtRateStart) / Elapsed);
+		ReceiveRate = static_cast<int64>((BytesReceived - BytesReceivedAtRateStart) / Elapsed);
+		BytesSentAtRateStart = BytesSent;
+		BytesReceivedAtRateStart = BytesReceived;
+		RateStartTime = Time;
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// Server
+//----------------------------------------------------------------------------------------------------
+
+TUniquePtr<FImGuiRemoteServer> FImGuiRemoteServer::Create(FImGuiContextManager& ContextManager, int32 ContextIndex, int32 Port)
+{
+	FSocket* ListenSocket = FTcpSocketBuilder(TEXT("ImGuiRemoteServer"))
+		.AsReusable()
+		.AsNonBlocking()
+		.BoundToEndpoint(FIPv4Endpoint(FIPv4Address::InternalLoopback, Port))
+		.Listening(1);
+
+	if (!ListenSocket)
+	{
+		UE_LOG(LogImGuiRemote, Error, TEXT("Failed to start ImGui remote server on port %d."), Port);
+		return nullptr;
+	}
+
+	UE_LOG(LogImGuiRemote, Log, TEXT("ImGui remote server listening on port %d."), Port);
+	return TUniquePtr<FImGuiRemoteServer>(new FImGuiRemoteServer(ContextManager, ContextIndex, Port, ListenSocket));
+}
+
+FImGuiRemoteServer::FImGuiRemoteServer(FImGuiContextManager& InContextManager, int32 InContextIndex, int32 InPort, FSocket* InListenSocket)
+	: ContextManager(InContextManager)
+	, ContextIndex(InContextIndex)
+	, Port(InPort)
+	, ListenSocket(InListenSocket)
+{
+	ContextManager.OnFontAtlasBuilt.AddRaw(this, &FImGuiRemoteServer::InvalidateFontAtlas);
+}
+
+FImGuiRemoteServer::~FImGuiRemoteServer()
+{
+	ContextManager.OnFontAtlasBuilt.RemoveAll(this);
+
+	Connection.Reset();
+	DestroySocket(ListenSocket);
+}
+
+void FImGuiRemoteServer::Tick()
+{
+	if (!Connection)
+	{
+		AcceptConnection();
+	}
+
+	if (Connection && Connection->Update())
+	{
+		if (FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(ContextIndex))
+		{
+			uint32 Type;
+			while (Connection->PopMessage(Type, Message))
+			{
+				if (Type == RemoteMessage_Input)
+				{
+					ApplyInput(*ContextProxy, Message);
+				}
+				else if (Type == RemoteMessage_DisplaySize && Message.Num() == sizeof(float) * 2)
+				{
+					const float* Size = reinterpret_cast<const float*>(Message.GetData());
+					ContextProxy->SetDisplaySize({ Size[0], Size[1] });
+				}
+				else if (Type == RemoteMessage_KeyFrameRequest)
+				{
+					// Viewer failed to decode a frame, so the next one needs to be encoded without deltas.
+					Encoder.ForceKeyFrame();
+					LastDrawDataVersion = 0;
+				}
+			}
+
+			if (bFontAtlasDirty)
+			{
+				SendFontAtlas();
+			}
+
+			if (ContextProxy->GetDrawDataVersion() != LastDrawDataVersion)
+			{
+				LastDrawDataVersion = ContextProxy->GetDrawDataVersion();
+				SendFrame(*ContextProxy);
+			}
+		}
+
+		// Flush data queued in this tick.
+		if (Connection->Update())
+		{
+			return;
+		}
+	}
+
+	if (Connection)
+	{
+		UE_LOG(LogImGuiRemote, Log, TEXT("ImGui remote viewer disconnected (sent %d frames, %lld KB)."),
+			NumFramesSent, Connection->GetBytesSent() / 1024);
+		Connection.Reset();
+	}
+}
+
+void FImGuiRemoteServer::AcceptConnection()
+{
+	bool bHasPendingConnection = false;
+	if (ListenSocket->HasPendingConnection(bHasPendingConnection) && bHasPendingConnection)
+	{
+		if (FSocket* Socket = ListenSocket->Accept(TEXT("ImGuiRemoteViewer")))
+		{
+			Socket->SetNonBlocking(true);
+			Connection = MakeUnique<FImGuiRemoteConnection>(Socket);
+
+			// New viewer needs font atlas and a key frame.
+			Encoder.ForceKeyFrame();
+			bFontAtlasDirty = true;
+			LastDrawDataVersion = 0;
+			NumFramesSent = 0;
+			NumFramesSkipped = 0;
+
+			UE_LOG(LogImGuiRemote, Log, TEXT("ImGui remote viewer connected."));
+		}
+	}
+}
+
+void FImGuiRemoteServer::SendFontAtlas()
+{
+	bFontAtlasDirty = false;
+
+	ImFontAtlas& FontAtlas = ContextManager.GetFontAtlas();
+
+	unsigned char* Pixels;
+	int Width, Height, Bpp;
+	FontAtlas.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
+
+	const int32 RawSize = Width * Height * Bpp;
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, RawSize);
+
+	const FFontAtlasHeader Header{ ImGuiInterops::ToTextureIndex(FontAtlas.TexID), Width, Height, RawSize };
+
+	Message.SetNumUninitialized(sizeof(Header) + CompressedSize);
+	FMemory::Memcpy(Message.GetData(), &Header, sizeof(Header));
+	if (!FCompression::CompressMemory(NAME_Zlib, Message.GetData() + sizeof(Header), CompressedSize, Pixels, RawSize))
+	{
+		UE_LOG(LogImGuiRemote, Error, TEXT("Failed to compress font atlas."));
+		return;
+	}
+
+	Message.SetNum(sizeof(Header) + CompressedSize);
+	Connection->Send(RemoteMessage_FontAtlas, Message);
+}
+
+void FImGuiRemoteServer::SendFrame(const FImGuiContextProxy& ContextProxy)
+{
+	// Skip frames while viewer is behind. Encoder is not updated, so the next frame is still encoded as a delta from
+	// the last sent one.
+	if (Connection->GetPendingBytes() > MaxPendingBytes)
+	{
+		NumFramesSkipped++;
+		return;
+	}
+
+	Message.Reset();
+	Encoder.Encode(ContextProxy.GetDrawData(), Message);
+	Connection->Send(RemoteMessage_Frame, Message);
+	NumFramesSent++;
+}
+
+void FImGuiRemoteServer::ApplyInput(FImGuiContextProxy& ContextProxy, const TArray<uint8>& Payload)
+{
+	// Input is routed through the input state, which queues it in the context until its next update. Events are
+	// allocated from the context allocator, so it is installed for the time of this call.
+	FImGuiContextProxy::FGuardCurrentContext GuardContext;
+	ContextProxy.SetAsCurrent();
+
+	FImGuiInputState& InputState = ContextProxy.GetInputState();
+
+	const int32 NumEvents = Payload.Num() / sizeof(FInputEvent);
+	const FInputEvent* Events = reinterpret_cast<const FInputEvent*>(Payload.GetData());
+	for (int32 Index = 0; Index < NumEvents; Index++)
+	{
+		const FInputEvent& Event = Events[Index];
+		switch (Event.Type)
+		{
+		case ImGuiInputEventType_MousePos:
+			InputState.SetMousePosition({ Event.X, Event.Y });
+			break;
+		case ImGuiInputEventType_MouseWheel:
+			InputState.AddMouseWheelDelta(Event.X, Event.Y);
+			break;
+		case ImGuiInputEventType_MouseButton:
+			if (Event.Code >= 0 && Event.Code < ImGuiMouseButton_COUNT)
+			{
+				InputState.SetMouseDown(Event.Code, Event.X != 0.f);
+			}
+			break;
+		case ImGuiInputEventType_Key:
+			if (ImGui::IsNamedKeyOrMod(static_cast<ImGuiKey>(Event.Code)) && !ImGui::IsAliasKey(static_cast<ImGuiKey>(Event.Code)))
+			{
+				InputState.SetKeyDown(static_cast<ImGuiKey>(Event.Code), Event.X != 0.f, Event.Y);
+			}
+			break;
+		case ImGuiInputEventType_Text:
+			InputState.AddCharacterCode(static_cast<uint32>(Event.Code));
+			break;
+		case ImGuiInputEventType_Focus:
+			InputState.SetFocus(Event.Code != 0);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// Client
+//----------------------------------------------------------------------------------------------------
+
+TSharedPtr<FImGuiRemoteClient> FImGuiRemoteClient::Create(FTextureManager& TextureManager, const FString& Host, int32 Port)
+{
+	FIPv4Address Address;
+	if (!FIPv4Address::Parse(Host, Address))
+	{
+		UE_LOG(LogImGuiRemote, Error, TEXT("Invalid ImGui remote server address '%s'."), *Host);
+		return nullptr;
+	}
+
+	const FString ServerAddress = FString::Printf(TEXT("%s:%d"), *Host, Port);
+
+	// Non-blocking connect returns immediately and the connection is completed in Tick.
+	FSocket* Socket = FTcpSocketBuilder(TEXT("ImGuiRemoteClient")).AsNonBlocking().Build();
+	if (!Socket || !(Socket->Connect(*FIPv4Endpoint(Address, Port).ToInternetAddr()) || IsConnectInProgress()))
+	{
+		UE_LOG(LogImGuiRemote, Error, TEXT("Failed to connect to ImGui remote server at %s."), *ServerAddress);
+		DestroySocket(Socket);
+		return nullptr;
+	}
+
+	UE_LOG(LogImGuiRemote, Log, TEXT("Connecting to ImGui remote server at %s."), *ServerAddress);
+	return MakeShareable(new FImGuiRemoteClient(TextureManager, Socket, ServerAddress));
+}
+
+FImGuiRemoteClient::FImGuiRemoteClient(FTextureManager& InTextureManager, FSocket* Socket, const FString& InServerAddress)
+	: TextureManager(InTextureManager)
+	, Connection(MakeUnique<FImGuiRemoteConnection>(Socket))
+	, ServerAddress(InServerAddress)
+	, ConnectStartTime(FPlatformTime::Seconds())
+{
+}
+
+bool FImGuiRemoteClient::UpdateConnecting()
+{
+	const ESocketConnectionState State = Connection->GetConnectionState();
+	if (State == SCS_Connected)
+	{
+		bIsConnecting = false;
+		UE_LOG(LogImGuiRemote, Log, TEXT("Connected to ImGui remote server at %s."), *ServerAddress);
+		return true;
+	}
+
+	if (State == SCS_ConnectionError || FPlatformTime::Seconds() - ConnectStartTime > ConnectTimeout)
+	{
+		UE_LOG(LogImGuiRemote, Error, TEXT("Failed to connect to ImGui remote server at %s."), *ServerAddress);
+		return false;
+	}
+
+	return true;
+}
+
+bool FImGuiRemoteClient::Tick(FImGuiContextProxy& ContextProxy)
+{
+	if (bIsConnecting)
+	{
+		if (!UpdateConnecting())
+		{
+			return false;
+		}
+
+		// Input stays queued in the viewing context until connection is established.
+		if (bIsConnecting)
+		{
+			return true;
+		}
+	}
+
+	if (!Connection->Update())
+	{
+		return false;
+	}
+
+	uint32 Type;
+	while (Connection->PopMessage(Type, Message))
+	{
+		if (Type == RemoteMessage_FontAtlas)
+		{
+			ReceiveFontAtlas(Message);
+		}
+		else if (Type == RemoteMessage_Frame)
+		{
+			ReceiveFrame(Message);
+		}
+	}
+
+	SendInput(ContextProxy);
+
+	return Connection->Update();
+}
+
+bool FImGuiRemoteClient::ReadFrame(TArray<FImGuiDrawList>& OutDrawLists)
+{
+	if (bHasNewFrame)
+	{
+		bHasNewFrame = false;
+		Swap(OutDrawLists, DrawLists);
+		return true;
+	}
+
+	return false;
+}
+
+void FImGuiRemoteClient::ReceiveFontAtlas(const TArray<uint8>& Payload)
+{
+	FFontAtlasHeader Header;
+	if (Payload.Num() < static_cast<int32>(sizeof(Header)))
+	{
+		return;
+	}
+	FMemory::Memcpy(&Header, Payload.GetData(), sizeof(Header));
+
+	// Header comes from the network, so size needs to be validated before allocating and uploading pixels.
+	if (Header.Width <= 0 || Header.Width > MaxFontAtlasSize || Header.Height <= 0 || Header.Height > MaxFontAtlasSize
+		|| static_cast<int64>(Header.RawSize) != static_cast<int64>(Header.Width) * Header.Height * 4)
+	{
+		UE_LOG(LogImGuiRemote, Error, TEXT("Rejected font atlas with invalid size %dx%d (%d bytes) received from the remote server."),
+			Header.Width, Header.Height, Header.RawSize);
+		return;
+	}
+
+	// Texture data are uploaded asynchronously, so they are kept alive by the cleanup function.
+	TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Pixels = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+	Pixels->SetNumUninitialized(Header.RawSize);
+	if (!FCompression::UncompressMemory(NAME_Zlib, Pixels->GetData(), Header.RawSize, Payload.GetData() + sizeof(Header), Payload.Num() - sizeof(Header)))
+	{
+		UE_LOG(LogImGuiRemote, Error, TEXT("Failed to decompress font atlas received from the remote server."));
+		return;
+	}
+
+	static const FName RemoteFontAtlasTextureName = "ImGuiModule_RemoteFontAtlas";
+	const TextureIndex LocalTextureId = TextureManager.CreateTexture(RemoteFontAtlasTextureName, Header.Width, Header.Height,
+		4, Pixels->GetData(), [Pixels](uint8*) {});
+
+	TextureMap.Add(Header.TextureId, LocalTextureId);
+}
+
+void FImGuiRemoteClient::ReceiveFrame(const TArray<uint8>& Payload)
+{
+	if (!Decoder.Decode(Payload.GetData(), Payload.Num(), DrawLists))
+	{
+		// Decoder keeps rejecting delta frames until it gets a key frame, so ask the server for one. Request is sent
+		// only once, as the key frame is already on its way when the following delta frames are rejected.
+		if (Decoder.NeedsKeyFrame() && !bKeyFrameRequested)
+		{
+			UE_LOG(LogImGuiRemote, Warning, TEXT("Failed to decode frame received from the remote server, requesting a key frame."));
+			bKeyFrameRequested = true;
+			Message.Reset();
+			Connection->Send(RemoteMessage_KeyFrameRequest, Message);
+		}
+		return;
+	}
+
+	bKeyFrameRequested = false;
+
+	// Map server textures to local ones. Textures that were not transferred are replaced with the plain texture.
+	for (FImGuiDrawList& DrawList : DrawLists)
+	{
+		DrawList.RemapTextures([this](TextureIndex Index)
+		{
+			const TextureIndex* LocalIndex = TextureMap.Find(Index);
+			return LocalIndex ? *LocalIndex : 0;
+		});
+	}
+
+	bHasNewFrame = true;
+	NumFramesReceived++;
+}
+
+void FImGuiRemoteClient::SendInput(FImGuiContextProxy& ContextProxy)
+{
+	// Context is not updated while presenting remote frames, so events queued by the input state remain in its queue.
+	// Move them to the server.
+	Message.Reset();
+	ContextProxy.GetInputState().ConsumeQueuedEvents([this](const ImGuiInputEvent& Event)
+	{
+		FInputEvent RemoteEvent{ Event.Type, 0, 0.f, 0.f };
+		switch (Event.Type)
+		{
+		case ImGuiInputEventType_MousePos:
+			RemoteEvent.X = Event.MousePos.PosX;
+			RemoteEvent.Y = Event.MousePos.PosY;
+			break;
+		case ImGuiInputEventType_MouseWheel:
+			RemoteEvent.X = Event.MouseWheel.WheelX;
+			RemoteEvent.Y = Event.MouseWheel.WheelY;
+			break;
+		case ImGuiInputEventType_MouseButton:
+			RemoteEvent.Code = Event.MouseButton.Button;
+			RemoteEvent.X = Event.MouseButton.Down ? 1.f : 0.f;
+			break;
+		case ImGuiInputEventType_Key:
+			RemoteEvent.Code = Event.Key.Key;
+			RemoteEvent.X = Event.Key.Down ? 1.f : 0.f;
+			RemoteEvent.Y = Event.Key.AnalogValue;
+			break;
+		case ImGuiInputEventType_Text:
+			RemoteEvent.Code = static_cast<int32>(Event.Text.Char);
+			break;
+		case ImGuiInputEventType_Focus:
+			RemoteEvent.Code = Event.AppFocused.Focused ? 1 : 0;
+			break;
+		default:
+			return;
+		}
+		AppendBytes(Message, &RemoteEvent, sizeof(RemoteEvent));
+	});
+
+	if (Message.Num() > 0)
+	{
+		Connection->Send(RemoteMessage_Input, Message);
+	}
+
+	// Let the server match the canvas size of the viewer.
+	const FVector2D& DisplaySize = ContextProxy.GetDisplaySize();
+	if (DisplaySize != LastDisplaySize)
+	{
+		LastDisplaySize = DisplaySize;
+
+		const float Size[] = { static_cast<float>(DisplaySize.X), static_cast<float>(DisplaySize.Y) };
+		Message.Reset();
+		AppendBytes(Message, Size, sizeof(Size));
+		Connection->Send(RemoteMessage_DisplaySize, Message);
+	}
+}
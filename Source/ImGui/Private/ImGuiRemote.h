@@ -0,0 +1,228 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "ImGuiDrawDataCapture.h"
+#include "TextureManager.h"
+
+#include <SocketTypes.h>
+#include <Templates/UniquePtr.h>
+
+
+class FImGuiContextManager;
+class FImGuiContextProxy;
+class FSocket;
+
+// Message connection over a TCP socket, used by remote server and client. Messages are buffered and exchanged without
+// blocking the game thread.
+class FImGuiRemoteConnection
+{
+public:
+
+	FImGuiRemoteConnection(FSocket* InSocket);
+	~FImGuiRemoteConnection();
+
+	FImGuiRemoteConnection(const FImGuiRemoteConnection&) = delete;
+	FImGuiRemoteConnection& operator=(const FImGuiRemoteConnection&) = delete;
+
+	// Queue a message to send.
+	// @param Type - Message type
+	// @param Payload - Message data
+	void Send(uint32 Type, const TArray<uint8>& Payload);
+
+	// Send queued data and receive pending data.
+	// @returns False, if connection was closed or the other side sent a malformed message
+	bool Update();
+
+	// Get the next received message. Messages bigger than MaxMessageSize are malformed and break the connection.
+	// @param OutType - Message type
+	// @param OutPayload - Buffer to which message data are copied
+	// @returns True, if there was a complete message to read
+	bool PopMessage(uint32& OutType, TArray<uint8>& OutPayload);
+
+	// Get the state of the socket, which can be used to wait until a non-blocking connect completes.
+	ESocketConnectionState GetConnectionState() const;
+
+	// Get the number of bytes queued, but not yet sent.
+	int32 GetPendingBytes() const { return SendBuffer.Num(); }
+
+	// Get the total number of bytes sent through this connection.
+	int64 GetBytesSent() const { return BytesSent; }
+
+	// Get the total number of bytes received through this connection.
+	int64 GetBytesReceived() const { return BytesReceived; }
+
+	// Get the number of bytes sent during the last second.
+	int64 GetSendRate() const { return SendRate; }
+
+	// Get the number of bytes received during the last second.
+	int64 GetReceiveRate() const { return ReceiveRate; }
+
+	// Messages bigger than this are rejected, so the other side can't make the receive buffer grow without limit.
+	static constexpr uint32 MaxMessageSize = 64 * 1024 * 1024;
+
+private:
+
+	void UpdateRates();
+
+	FSocket* Socket = nullptr;
+
+	TArray<uint8> SendBuffer;
+	TArray<uint8> ReceiveBuffer;
+	int32 ReceiveOffset = 0;
+
+	bool bIsBroken = false;
+
+	int64 BytesSent = 0;
+	int64 BytesReceived = 0;
+
+	int64 SendRate = 0;
+	int64 ReceiveRate = 0;
+	int64 BytesSentAtRateStart = 0;
+	int64 BytesReceivedAtRateStart = 0;
+	double RateStartTime = 0.0;
+};
+
+// Streams draw data of a single context to a remote viewer and applies input events received from that viewer to the
+// context. It doesn't need any widget, so it allows to use ImGui in builds without viewports (e.g. dedicated servers).
+// Only one viewer can be connected at a time.
+class FImGuiRemoteServer
+{
+public:
+
+	// Create server listening on local address.
+	// @param ContextManager - Manager of the streamed context
+	// @param ContextIndex - Index of the streamed context
+	// @param Port - Port to listen on
+	// @returns Server or null, if listen socket couldn't be created
+	static TUniquePtr<FImGuiRemoteServer> Create(FImGuiContextManager& ContextManager, int32 ContextIndex, int32 Port);
+
+	~FImGuiRemoteServer();
+
+	// Accept viewers, send new frames and apply received input. Should be called once per frame after contexts are
+	// updated.
+	void Tick();
+
+	// Get index of the streamed context.
+	int32 GetContextIndex() const { return ContextIndex; }
+
+	// Get the port on which this server is listening.
+	int32 GetPort() const { return Port; }
+
+	// Get the connection with the current viewer or null, if no viewer is connected.
+	const FImGuiRemoteConnection* GetConnection() const { return Connection.Get(); }
+
+	// Get the number of frames sent to the current viewer.
+	int32 GetNumFramesSent() const { return NumFramesSent; }
+
+	// Get the number of frames skipped because the viewer couldn't receive them fast enough.
+	int32 GetNumFramesSkipped() const { return NumFramesSkipped; }
+
+private:
+
+	FImGuiRemoteServer(FImGuiContextManager& InContextManager, int32 InContextIndex, int32 InPort, FSocket* InListenSocket);
+
+	void AcceptConnection();
+
+	void InvalidateFontAtlas() { bFontAtlasDirty = true; }
+
+	void SendFontAtlas();
+	void SendFrame(const FImGuiContextProxy& ContextProxy);
+	void ApplyInput(FImGuiContextProxy& ContextProxy, const TArray<uint8>& Payload);
+
+	FImGuiContextManager& ContextManager;
+	int32 ContextIndex;
+	int32 Port;
+
+	FSocket* ListenSocket = nullptr;
+	TUniquePtr<FImGuiRemoteConnection> Connection;
+
+	FImGuiDrawDataEncoder Encoder;
+	TArray<uint8> Message;
+
+	uint32 LastDrawDataVersion = 0;
+	int32 NumFramesSent = 0;
+	int32 NumFramesSkipped = 0;
+
+	bool bFontAtlasDirty = true;
+};
+
+// Viewer for a remote server. It presents frames received from the server in a local context and sends back input
+// events queued in that context.
+class FImGuiRemoteClient : public IImGuiDrawDataSource
+{
+public:
+
+	// Start connecting to a remote server. Connection is completed in the background, without blocking the game thread.
+	// @param TextureManager - Texture manager used to create textures received from the server
+	// @param Host - Server IP address
+	// @param Port - Server port
+	// @returns Client connecting to the server or null, if connection couldn't be started
+	static TSharedPtr<FImGuiRemoteClient> Create(FTextureManager& TextureManager, const FString& Host, int32 Port);
+
+	// Complete connecting, receive frames and send input events queued in the viewing context.
+	// @param ContextProxy - Context in which received frames are presented
+	// @returns False, if connection failed or was closed
+	bool Tick(FImGuiContextProxy& ContextProxy);
+
+	virtual bool ReadFrame(TArray<FImGuiDrawList>& OutDrawLists) override;
+
+	// Get the connection with the server.
+	const FImGuiRemoteConnection& GetConnection() const { return *Connection; }
+
+	// Get the number of frames received from the server.
+	int32 GetNumFramesReceived() const { return NumFramesReceived; }
+
+private:
+
+	FImGuiRemoteClient(FTextureManager& InTextureManager, FSocket* Socket, const FString& InServerAddress);
+
+	bool UpdateConnecting();
+
+	void ReceiveFontAtlas(const TArray<uint8>& Payload);
+	void ReceiveFrame(const TArray<uint8>& Payload);
+	void SendInput(FImGuiContextProxy& ContextProxy);
+
+	FTextureManager& TextureManager;
+	TUniquePtr<FImGuiRemoteConnection> Connection;
+	FString ServerAddress;
+	double ConnectStartTime = 0.0;
+
+	FImGuiDrawDataDecoder Decoder;
+	TArray<FImGuiDrawList> DrawLists;
+	TArray<uint8> Message;
+
+	// Maps texture indices used by the server to local texture indices.
+	TMap<TextureIndex, TextureIndex> TextureMap;
+
+	FVector2D LastDisplaySize = FVector2D::ZeroVector;
+	int32 NumFramesReceived = 0;
+	bool bHasNewFrame = false;
+	bool bIsConnecting = true;
+
+	// Set after requesting a key frame, so the request is not repeated for every delta frame rejected until the key
+	// frame arrives.
+	bool bKeyFrameRequested = false;
+};
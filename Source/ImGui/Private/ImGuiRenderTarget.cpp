@@ -0,0 +1,356 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "ImGuiRenderTarget.h"
+
+#include "ImGuiContextProxy.h"
+#include "TextureManager.h"
+
+#include <Engine/TextureRenderTarget2D.h>
+#include <Framework/Application/SlateApplication.h>
+#include <Rendering/DrawElements.h>
+#include <RenderingThread.h>
+#include <Slate/WidgetRenderer.h>
+#include <Widgets/SLeafWidget.h>
+
+
+namespace
+{
+	// Maximum size of the render target in each dimension. With larger canvases, output is rendered at lower resolution.
+	constexpr int32 MaxTargetSize = 8192;
+
+	// Maximum number of separate rectangles redrawn in one update. With more, they are merged into one bounding
+	// rectangle, so the number of passes over draw lists stays low.
+	constexpr int32 MaxDirtyRects = 8;
+
+	// Whether render target and widget renderer should use gamma correction (must be the same for both).
+	constexpr bool bUseGammaCorrection = true;
+}
+
+// Widget drawn by the widget renderer to update the render target. Its window space matches render target space.
+class SImGuiRenderTargetContent : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SImGuiRenderTargetContent)
+	{}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const FImGuiRenderTarget* InOwner)
+	{
+		Owner = InOwner;
+	}
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& WidgetStyle, bool bParentEnabled) const override
+	{
+		return Owner->PaintContent(AllottedGeometry, OutDrawElements, LayerId);
+	}
+
+	virtual FVector2D ComputeDesiredSize(float) const override
+	{
+		return FVector2D{ Owner->GetSize() };
+	}
+
+private:
+
+	const FImGuiRenderTarget* Owner = nullptr;
+};
+
+FImGuiRenderTarget::FImGuiRenderTarget(FTextureManager& InTextureManager)
+	: TextureManager(InTextureManager)
+{
+	// The target is not cleared, so areas that didn't change keep their content between updates.
+	WidgetRenderer = new FWidgetRenderer(bUseGammaCorrection, false);
+	ContentWidget = SNew(SImGuiRenderTargetContent, this);
+}
+
+FImGuiRenderTarget::~FImGuiRenderTarget()
+{
+	if (Brush.HasUObject() && FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().GetRenderer()->ReleaseDynamicResource(Brush);
+	}
+
+	// Widget renderer can still be used by the rendering thread, so it needs a deferred cleanup.
+	BeginCleanup(WidgetRenderer);
+}
+
+void FImGuiRenderTarget::Update(const FImGuiContextProxy& ContextProxy, float Scale)
+{
+	const FVector2D& DisplaySize = ContextProxy.GetDisplaySize();
+
+	bool bFullRedraw = (&ContextProxy != CachedContextProxy) || (DisplaySize != CachedDisplaySize) || (Scale != CachedScale);
+	if (!bFullRedraw && ContextProxy.GetDrawDataVersion() == CachedDrawDataVersion
+		&& TextureManager.GetRevision() == CachedTextureRevision)
+	{
+		return;
+	}
+
+	CachedContextProxy = &ContextProxy;
+	CachedDrawDataVersion = ContextProxy.GetDrawDataVersion();
+	CachedTextureRevision = TextureManager.GetRevision();
+	CachedDisplaySize = DisplaySize;
+	CachedScale = Scale;
+
+	// Scale is limited to keep the render target within supported size.
+	const float TargetScale = FMath::Min3(Scale, MaxTargetSize / FMath::Max<float>(DisplaySize.X, 1.f), MaxTargetSize / FMath::Max<float>(DisplaySize.Y, 1.f));
+	const FIntPoint TargetSize{ FMath::Max(FMath::CeilToInt(DisplaySize.X * TargetScale), 1), FMath::Max(FMath::CeilToInt(DisplaySize.Y * TargetScale), 1) };
+	if (TargetSize != Size)
+	{
+		ResizeTarget(TargetSize);
+		bFullRedraw = true;
+	}
+
+	// Target size is rounded up, so the canvas might not cover the whole target.
+	CanvasUV = FVector2D{ DisplaySize.X * TargetScale / Size.X, DisplaySize.Y * TargetScale / Size.Y };
+
+	UpdateStats = {};
+	DirtyRects.Reset();
+	if (bFullRedraw)
+	{
+		AddDirtyRect(FSlateRect{ 0.f, 0.f, static_cast<float>(Size.X), static_cast<float>(Size.Y) });
+	}
+
+	// Compare draw lists with those from the last update and mark areas covered by old and new versions of changed lists
+	// as dirty. Lists are compared by position, so reordering (e.g. when a window is focused) marks all moved lists.
+	const FSlateRenderTransform ImGuiToTarget{ FScale2f{ TargetScale } };
+	const TArray<FImGuiDrawList>& DrawLists = ContextProxy.GetDrawData();
+	const int32 NumPreviousDrawLists = DrawListHashes.Num();
+	for (int32 Index = 0; Index < DrawLists.Num(); Index++)
+	{
+		const uint64 Hash = DrawLists[Index].GetContentHash(TextureManager);
+		const FSlateRect Bounds = DrawLists[Index].GetClippingBounds(ImGuiToTarget);
+		if (Index >= NumPreviousDrawLists)
+		{
+			AddDirtyRect(Bounds);
+			DrawListHashes.Add(Hash);
+			DrawListBounds.Add(Bounds);
+		}
+		else if (Hash != DrawListHashes[Index])
+		{
+			AddDirtyRect(DrawListBounds[Index]);
+			AddDirtyRect(Bounds);
+			DrawListHashes[Index] = Hash;
+			DrawListBounds[Index] = Bounds;
+		}
+	}
+	for (int32 Index = DrawLists.Num(); Index < NumPreviousDrawLists; Index++)
+	{
+		AddDirtyRect(DrawListBounds[Index]);
+	}
+	DrawListHashes.SetNum(DrawLists.Num());
+	DrawListBounds.SetNum(DrawLists.Num());
+
+	// Draw data can be updated without changing the output, in which case there is nothing to do.
+	if (DirtyRects.Num() == 0)
+	{
+		return;
+	}
+
+	// Convert draw lists that overlap dirty rectangles. Those are all lists that need to be redrawn, including unchanged
+	// ones below or above the changed ones.
+	NumConvertedDrawLists = 0;
+	for (int32 Index = 0; Index < DrawLists.Num(); Index++)
+	{
+		if (DirtyRects.ContainsByPredicate([&](const FSlateRect& Rect) { return FSlateRect::DoRectanglesIntersect(Rect, DrawListBounds[Index]); }))
+		{
+			ConvertDrawList(DrawLists[Index], ImGuiToTarget);
+			UpdateStats.NumRedrawnDrawLists++;
+			UpdateStats.NumRedrawnVertices += DrawLists[Index].NumVertices();
+		}
+	}
+	UpdateStats.NumDirtyRects = DirtyRects.Num();
+
+	WidgetRenderer->DrawWidget(RenderTarget.Get(), ContentWidget.ToSharedRef(), FVector2D{ Size }, 0.f);
+}
+
+void FImGuiRenderTarget::Paint(FSlateWindowElementList& OutDrawElements, int32 LayerId, const FSlateRenderTransform& ImGuiToScreen, const FSlateRect& ClippingRect) const
+{
+	if (!RenderTarget.IsValid())
+	{
+		return;
+	}
+
+	// Quad covering the canvas.
+	const FVector2D Corners[] = { { 0.f, 0.f }, { 1.f, 0.f }, { 1.f, 1.f }, { 0.f, 1.f } };
+
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4)
+	QuadVertexBuffer.SetNumUninitialized(UE_ARRAY_COUNT(Corners), EAllowShrinking::No);
+#else
+	QuadVertexBuffer.SetNumUninitialized(UE_ARRAY_COUNT(Corners), false);
+#endif
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Corners); Index++)
+	{
+		FSlateVertex& Vertex = QuadVertexBuffer[Index];
+
+		// Final UV is calculated in shader as XY * ZW, so we need set all components.
+		Vertex.TexCoords[0] = Corners[Index].X * CanvasUV.X;
+		Vertex.TexCoords[1] = Corners[Index].Y * CanvasUV.Y;
+		Vertex.TexCoords[2] = Vertex.TexCoords[3] = 1.f;
+		Vertex.Position = (FVector2f)ImGuiToScreen.TransformPoint(Corners[Index] * CachedDisplaySize);
+		Vertex.Color = FColor::White;
+	}
+
+	if (QuadIndexBuffer.Num() == 0)
+	{
+		QuadIndexBuffer = { 0, 1, 2, 0, 2, 3 };
+	}
+
+	// Slate blends with alpha into the render target, so its color is already multiplied by alpha.
+	OutDrawElements.PushClip(FSlateClippingZone{ ClippingRect });
+	FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, ResourceHandle, QuadVertexBuffer, QuadIndexBuffer, nullptr, 0, 0,
+		ESlateDrawEffect::PreMultipliedAlpha);
+	OutDrawElements.PopClip();
+}
+
+void FImGuiRenderTarget::ResizeTarget(const FIntPoint& NewSize)
+{
+	if (RenderTarget.IsValid())
+	{
+		RenderTarget->ResizeTarget(NewSize.X, NewSize.Y);
+	}
+	else
+	{
+		// Sampling without filtering, as the render target is presented with the scale at which it is rendered.
+		RenderTarget.Reset(FWidgetRenderer::CreateTargetFor(FVector2D{ NewSize }, TF_Nearest, bUseGammaCorrection));
+		RenderTarget->ClearColor = FLinearColor::Transparent;
+		Brush.SetResourceObject(RenderTarget.Get());
+	}
+
+	Brush.ImageSize = FVector2D{ NewSize };
+	ResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(Brush);
+	Size = NewSize;
+}
+
+void FImGuiRenderTarget::AddDirtyRect(const FSlateRect& Rect)
+{
+	// Round outwards to whole pixels and clamp to the render target.
+	FSlateRect DirtyRect{
+		FMath::FloorToFloat(FMath::Max(Rect.Left, 0.f)),
+		FMath::FloorToFloat(FMath::Max(Rect.Top, 0.f)),
+		FMath::CeilToFloat(FMath::Min(Rect.Right, static_cast<float>(Size.X))),
+		FMath::CeilToFloat(FMath::Min(Rect.Bottom, static_cast<float>(Size.Y))) };
+
+	if (DirtyRect.Right <= DirtyRect.Left || DirtyRect.Bottom <= DirtyRect.Top)
+	{
+		return;
+	}
+
+	// Merge with overlapping rectangles, so no area is cleared and redrawn twice. Merged rectangle can overlap those
+	// that were already checked, so checking starts again after every merge.
+	for (int32 Index = 0; Index < DirtyRects.Num();)
+	{
+		if (FSlateRect::DoRectanglesIntersect(DirtyRects[Index], DirtyRect))
+		{
+			DirtyRect = DirtyRect.Expand(DirtyRects[Index]);
+			DirtyRects.RemoveAtSwap(Index);
+			Index = 0;
+		}
+		else
+		{
+			Index++;
+		}
+	}
+
+	if (DirtyRects.Num() == MaxDirtyRects)
+	{
+		for (const FSlateRect& Other : DirtyRects)
+		{
+			DirtyRect = DirtyRect.Expand(Other);
+		}
+		DirtyRects.Reset();
+	}
+
+	DirtyRects.Add(DirtyRect);
+}
+
+void FImGuiRenderTarget::ConvertDrawList(const FImGuiDrawList& DrawList, const FSlateRenderTransform& ImGuiToTarget)
+{
+	if (NumConvertedDrawLists == ConvertedDrawLists.Num())
+	{
+		ConvertedDrawLists.AddDefaulted();
+	}
+	FConvertedDrawList& ConvertedDrawList = ConvertedDrawLists[NumConvertedDrawLists++];
+	ConvertedDrawList.NumCommands = 0;
+
+	DrawList.CopyVertexData(ConvertedDrawList.VertexBuffer, ImGuiToTarget);
+
+	int IndexBufferOffset = 0;
+	for (int CommandNb = 0; CommandNb < DrawList.NumCommands(); CommandNb++)
+	{
+		const auto& DrawCommand = DrawList.GetCommand(CommandNb, ImGuiToTarget);
+
+		if (ConvertedDrawList.NumCommands == ConvertedDrawList.Commands.Num())
+		{
+			ConvertedDrawList.Commands.AddDefaulted();
+		}
+		FConvertedDrawCommand& ConvertedCommand = ConvertedDrawList.Commands[ConvertedDrawList.NumCommands++];
+
+		DrawList.CopyIndexData(ConvertedCommand.IndexBuffer, IndexBufferOffset, DrawCommand.NumElements);
+		ConvertedCommand.ClippingRect = DrawCommand.ClippingRect;
+		ConvertedCommand.TextureId = DrawCommand.TextureId;
+
+		// Advance offset by number of copied elements to position it for the next command.
+		IndexBufferOffset += DrawCommand.NumElements;
+	}
+}
+
+int32 FImGuiRenderTarget::PaintContent(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId) const
+{
+	for (const FSlateRect& DirtyRect : DirtyRects)
+	{
+		// Clear the dirty rectangle. Without blending, the transparent box replaces the old content.
+		OutDrawElements.PushClip(FSlateClippingZone{ DirtyRect });
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), &ClearBrush,
+			ESlateDrawEffect::NoBlending, FLinearColor::Transparent);
+		OutDrawElements.PopClip();
+
+		// Redraw draw lists, clipping them to the dirty rectangle.
+		for (int32 DrawListNb = 0; DrawListNb < NumConvertedDrawLists; DrawListNb++)
+		{
+			const FConvertedDrawList& DrawList = ConvertedDrawLists[DrawListNb];
+			for (int32 CommandNb = 0; CommandNb < DrawList.NumCommands; CommandNb++)
+			{
+				const FConvertedDrawCommand& DrawCommand = DrawList.Commands[CommandNb];
+
+				bool bOverlapping = false;
+				const FSlateRect ClippingRect = DrawCommand.ClippingRect.IntersectionWith(DirtyRect, bOverlapping);
+				if (!bOverlapping)
+				{
+					continue;
+				}
+
+				const FSlateResourceHandle& Handle = TextureManager.GetTextureHandle(DrawCommand.TextureId);
+
+				OutDrawElements.PushClip(FSlateClippingZone{ ClippingRect });
+				FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 1, Handle, DrawList.VertexBuffer, DrawCommand.IndexBuffer, nullptr, 0, 0);
+				OutDrawElements.PopClip();
+			}
+		}
+	}
+
+	return LayerId + 1;
+}
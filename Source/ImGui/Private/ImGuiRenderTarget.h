@@ -0,0 +1,149 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include "ImGuiDrawData.h"
+
+#include <Brushes/SlateColorBrush.h>
+#include <Rendering/RenderingCommon.h>
+#include <Styling/SlateBrush.h>
+#include <UObject/StrongObjectPtr.h>
+
+
+class FImGuiContextProxy;
+class FSlateWindowElementList;
+struct FGeometry;
+class FTextureManager;
+class FWidgetRenderer;
+class SImGuiRenderTargetContent;
+class UTextureRenderTarget2D;
+
+// Composes ImGui output in a render target, which is then presented as a single textured quad. Draw lists are compared
+// with those from the last update and only rectangles covering the ones that changed are cleared and redrawn. For mostly
+// static output, this makes painting cost independent of the number of vertices.
+class FImGuiRenderTarget
+{
+public:
+
+	// Statistics collected during the last update.
+	struct FUpdateStats
+	{
+		int32 NumDirtyRects = 0;
+		int32 NumRedrawnDrawLists = 0;
+		int32 NumRedrawnVertices = 0;
+	};
+
+	FImGuiRenderTarget(FTextureManager& InTextureManager);
+	~FImGuiRenderTarget();
+
+	// Copying and moving is disabled to protect resource ownership.
+	FImGuiRenderTarget(const FImGuiRenderTarget&) = delete;
+	FImGuiRenderTarget& operator=(const FImGuiRenderTarget&) = delete;
+
+	// Update render target with the latest draw data of the context. Does nothing, if draw data and textures didn't change
+	// since the last update. Changing context, canvas size or scale redraws the whole target.
+	// @param ContextProxy - Context with draw data to render
+	// @param Scale - Number of render target pixels per ImGui pixel (the scale of the transform used to present it)
+	void Update(const FImGuiContextProxy& ContextProxy, float Scale);
+
+	// Add a quad presenting the render target to the element list.
+	// @param OutDrawElements - Destination element list
+	// @param LayerId - Layer in which the quad should be drawn
+	// @param ImGuiToScreen - Transform from ImGui to screen space
+	// @param ClippingRect - Clipping rectangle in screen space
+	void Paint(FSlateWindowElementList& OutDrawElements, int32 LayerId, const FSlateRenderTransform& ImGuiToScreen, const FSlateRect& ClippingRect) const;
+
+	// Get statistics collected during the last update that changed the render target.
+	const FUpdateStats& GetUpdateStats() const { return UpdateStats; }
+
+	// Get the size of the render target in pixels.
+	const FIntPoint& GetSize() const { return Size; }
+
+private:
+
+	// Draw list converted to Slate geometry in render target space.
+	struct FConvertedDrawCommand
+	{
+		TArray<SlateIndex> IndexBuffer;
+		FSlateRect ClippingRect;
+		TextureIndex TextureId;
+	};
+
+	struct FConvertedDrawList
+	{
+		TArray<FSlateVertex> VertexBuffer;
+		TArray<FConvertedDrawCommand> Commands;
+		int32 NumCommands = 0;
+	};
+
+	void ResizeTarget(const FIntPoint& NewSize);
+
+	void AddDirtyRect(const FSlateRect& Rect);
+
+	void ConvertDrawList(const FImGuiDrawList& DrawList, const FSlateRenderTransform& ImGuiToTarget);
+
+	// Called by the content widget when the render target is drawn.
+	int32 PaintContent(const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId) const;
+
+	FTextureManager& TextureManager;
+
+	TStrongObjectPtr<UTextureRenderTarget2D> RenderTarget;
+	FSlateBrush Brush;
+	FSlateResourceHandle ResourceHandle;
+	FIntPoint Size = FIntPoint::ZeroValue;
+
+	// Part of the render target covered by the canvas, in texture coordinates.
+	FVector2D CanvasUV = FVector2D::UnitVector;
+
+	// Quad presenting the render target.
+	mutable TArray<FSlateVertex> QuadVertexBuffer;
+	mutable TArray<SlateIndex> QuadIndexBuffer;
+
+	FWidgetRenderer* WidgetRenderer = nullptr;
+	TSharedPtr<SImGuiRenderTargetContent> ContentWidget;
+	FSlateColorBrush ClearBrush{ FLinearColor::White };
+
+	// Hashes and bounds (in render target space) of draw lists from the last update.
+	TArray<uint64> DrawListHashes;
+	TArray<FSlateRect> DrawListBounds;
+
+	// Rectangles to redraw in the current update and draw lists overlapping them. Arrays are not shrunk to keep their
+	// allocations, so only the first NumConvertedDrawLists entries are valid.
+	TArray<FSlateRect> DirtyRects;
+	TArray<FConvertedDrawList> ConvertedDrawLists;
+	int32 NumConvertedDrawLists = 0;
+
+	// Key of the last update.
+	const FImGuiContextProxy* CachedContextProxy = nullptr;
+	uint32 CachedDrawDataVersion = 0;
+	uint32 CachedTextureRevision = 0;
+	FVector2D CachedDisplaySize = FVector2D::ZeroVector;
+	float CachedScale = 0.f;
+
+	FUpdateStats UpdateStats;
+
+	friend class SImGuiRenderTargetContent;
+};
@@ -0,0 +1,248 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "ImGuiSlateElement.h"
+
+#include "TextureManager.h"
+
+#include <ImGuiShaders.h>
+
+#include <Engine/Texture.h>
+#include <PipelineStateCache.h>
+#include <RenderResource.h>
+#include <RenderUtils.h>
+#include <RHIStaticStates.h>
+#include <TextureResource.h>
+
+#if !ENGINE_COMPATIBILITY_LEGACY_CUSTOM_SLATE_ELEMENT
+#include <RenderGraphBuilder.h>
+#endif
+
+
+namespace
+{
+	// Vertex declaration matching ImDrawVert: position, UV and packed RGBA color.
+	class FImGuiVertexDeclaration : public FRenderResource
+	{
+	public:
+
+		FVertexDeclarationRHIRef VertexDeclarationRHI;
+
+#if FROM_ENGINE_VERSION(5, 3)
+		virtual void InitRHI(FRHICommandListBase& RHICmdList) override
+#else
+		virtual void InitRHI() override
+#endif
+		{
+			constexpr uint16 Stride = sizeof(ImDrawVert);
+
+			FVertexDeclarationElementList Elements;
+			Elements.Add(FVertexElement(0, STRUCT_OFFSET(ImDrawVert, pos), VET_Float2, 0, Stride));
+			Elements.Add(FVertexElement(0, STRUCT_OFFSET(ImDrawVert, uv), VET_Float2, 1, Stride));
+			Elements.Add(FVertexElement(0, STRUCT_OFFSET(ImDrawVert, col), VET_UByte4N, 2, Stride));
+			VertexDeclarationRHI = PipelineStateCache::GetOrCreateVertexDeclaration(Elements);
+		}
+
+		virtual void ReleaseRHI() override
+		{
+			VertexDeclarationRHI.SafeRelease();
+		}
+	};
+
+	TGlobalResource<FImGuiVertexDeclaration> GImGuiVertexDeclaration;
+
+	template<typename TBufferType>
+	FBufferRHIRef CreateVolatileBuffer(FRHICommandList& RHICmdList, const TArray<TBufferType>& Data, const TCHAR* DebugName, bool bIndexBuffer)
+	{
+		const uint32 Size = Data.Num() * sizeof(TBufferType);
+		FRHIResourceCreateInfo CreateInfo(DebugName);
+		FBufferRHIRef Buffer = bIndexBuffer
+			? RHICmdList.CreateIndexBuffer(sizeof(TBufferType), Size, BUF_Volatile, CreateInfo)
+			: RHICmdList.CreateVertexBuffer(Size, BUF_Volatile, CreateInfo);
+
+		void* BufferData = RHICmdList.LockBuffer(Buffer, 0, Size, RLM_WriteOnly);
+		FMemory::Memcpy(BufferData, Data.GetData(), Size);
+		RHICmdList.UnlockBuffer(Buffer);
+
+		return Buffer;
+	}
+
+#if !ENGINE_COMPATIBILITY_LEGACY_CUSTOM_SLATE_ELEMENT
+	BEGIN_SHADER_PARAMETER_STRUCT(FImGuiSlateElementPassParameters, )
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+#endif
+}
+
+void FImGuiSlateElement::SetDrawData(const TArray<FImGuiDrawList>& DrawLists, const FSlateRenderTransform& ImGuiToScreen,
+	const FSlateRect& ClippingRect, const FTextureManager& TextureManager)
+{
+	VertexBuffer.Reset();
+	IndexBuffer.Reset();
+	Batches.Reset();
+	Transform = ImGuiToScreen;
+
+	for (const FImGuiDrawList& DrawList : DrawLists)
+	{
+		// Skip lists that are completely outside of the clipping rectangle.
+		if (!FSlateRect::DoRectanglesIntersect(DrawList.GetClippingBounds(ImGuiToScreen), ClippingRect))
+		{
+			continue;
+		}
+
+		const int32 BaseVertexIndex = VertexBuffer.Num();
+		int32 StartIndex = IndexBuffer.Num();
+		DrawList.AppendGeometry(VertexBuffer, IndexBuffer);
+
+		for (int CommandNb = 0; CommandNb < DrawList.NumCommands(); CommandNb++)
+		{
+			const FImGuiDrawCommand DrawCommand = DrawList.GetCommand(CommandNb, ImGuiToScreen);
+
+			bool bHasIntersection = false;
+			const FSlateRect CommandClippingRect = DrawCommand.ClippingRect.IntersectionWith(ClippingRect, bHasIntersection);
+			if (bHasIntersection && DrawCommand.NumElements > 0)
+			{
+				FBatch& Batch = Batches.AddDefaulted_GetRef();
+				Batch.ScissorRect = FIntRect(
+					FMath::FloorToInt(CommandClippingRect.Left), FMath::FloorToInt(CommandClippingRect.Top),
+					FMath::CeilToInt(CommandClippingRect.Right), FMath::CeilToInt(CommandClippingRect.Bottom));
+				// Resolve RHI resources here, because texture objects can be released before this element is drawn.
+				if (const UTexture* Texture = TextureManager.GetTexture(DrawCommand.TextureId))
+				{
+					if (const FTextureResource* Resource = Texture->GetResource())
+					{
+						Batch.Texture = Resource->TextureRHI;
+						Batch.TextureSampler = Resource->SamplerStateRHI;
+					}
+				}
+				Batch.BaseVertexIndex = BaseVertexIndex;
+				Batch.NumVertices = VertexBuffer.Num() - BaseVertexIndex;
+				Batch.StartIndex = StartIndex;
+				Batch.NumIndices = DrawCommand.NumElements;
+			}
+
+			StartIndex += DrawCommand.NumElements;
+		}
+	}
+}
+
+#if ENGINE_COMPATIBILITY_LEGACY_CUSTOM_SLATE_ELEMENT
+void FImGuiSlateElement::DrawRenderThread(FRHICommandListImmediate& RHICmdList, const void* RenderTarget)
+{
+	FRHITexture* RenderTargetTexture = static_cast<const FTexture2DRHIRef*>(RenderTarget)->GetReference();
+	if (!RenderTargetTexture)
+	{
+		return;
+	}
+
+	FRHIRenderPassInfo RenderPassInfo(RenderTargetTexture, ERenderTargetActions::Load_Store);
+	RHICmdList.BeginRenderPass(RenderPassInfo, TEXT("ImGui"));
+	Draw(RHICmdList, RenderTargetTexture->GetSizeXY());
+	RHICmdList.EndRenderPass();
+}
+#else
+void FImGuiSlateElement::Draw_RenderThread(FRDGBuilder& GraphBuilder, const FDrawPassInputs& Inputs)
+{
+	if (Batches.Num() == 0)
+	{
+		return;
+	}
+
+	FImGuiSlateElementPassParameters* PassParameters = GraphBuilder.AllocParameters<FImGuiSlateElementPassParameters>();
+	PassParameters->RenderTargets[0] = FRenderTargetBinding(Inputs.OutputTexture, ERenderTargetLoadAction::ELoad);
+
+	// Keep this element alive until the pass is executed.
+	GraphBuilder.AddPass(RDG_EVENT_NAME("ImGui"), PassParameters, ERDGPassFlags::Raster,
+		[This = AsShared(), ViewportSize = Inputs.OutputTexture->Desc.Extent](FRHICommandList& RHICmdList)
+		{
+			This->Draw(RHICmdList, ViewportSize);
+		});
+}
+#endif // ENGINE_COMPATIBILITY_LEGACY_CUSTOM_SLATE_ELEMENT
+
+void FImGuiSlateElement::Draw(FRHICommandList& RHICmdList, const FIntPoint& ViewportSize) const
+{
+	if (Batches.Num() == 0 || ViewportSize.X <= 0 || ViewportSize.Y <= 0)
+	{
+		return;
+	}
+
+	FBufferRHIRef VertexBufferRHI = CreateVolatileBuffer(RHICmdList, VertexBuffer, TEXT("ImGuiVertexBuffer"), false);
+	FBufferRHIRef IndexBufferRHI = CreateVolatileBuffer(RHICmdList, IndexBuffer, TEXT("ImGuiIndexBuffer"), true);
+
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	TShaderMapRef<FImGuiVS> VertexShader(ShaderMap);
+	TShaderMapRef<FImGuiPS> PixelShader(ShaderMap);
+
+	FGraphicsPipelineStateInitializer GraphicsPSOInit;
+	RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+
+	// Premultiply colour with alpha and accumulate coverage in the alpha channel, like Slate does for its elements.
+	GraphicsPSOInit.BlendState = TStaticBlendState<CW_RGBA, BO_Add, BF_SourceAlpha, BF_InverseSourceAlpha, BO_Add, BF_One, BF_InverseSourceAlpha>::GetRHI();
+	GraphicsPSOInit.RasterizerState = TStaticRasterizerState<FM_Solid, CM_None>::GetRHI();
+	GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_Always>::GetRHI();
+	GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GImGuiVertexDeclaration.VertexDeclarationRHI;
+	GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+	GraphicsPSOInit.BoundShaderState.PixelShaderRHI = PixelShader.GetPixelShader();
+	GraphicsPSOInit.PrimitiveType = PT_TriangleList;
+	SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+
+	RHICmdList.SetViewport(0.f, 0.f, 0.f, ViewportSize.X, ViewportSize.Y, 1.f);
+
+	float M00, M01, M10, M11;
+	Transform.GetMatrix().GetMatrix(M00, M01, M10, M11);
+
+	FImGuiVS::FParameters VertexParameters;
+	VertexParameters.TransformMatrix = FVector4f(M00, M01, M10, M11);
+	VertexParameters.TransformTranslation = FVector2f(Transform.GetTranslation());
+	VertexParameters.InvViewportSize = FVector2f(1.f / ViewportSize.X, 1.f / ViewportSize.Y);
+	SetShaderParameters(RHICmdList, VertexShader, VertexShader.GetVertexShader(), VertexParameters);
+
+	RHICmdList.SetStreamSource(0, VertexBufferRHI, 0);
+
+	const FIntRect ViewportRect(FIntPoint::ZeroValue, ViewportSize);
+	for (const FBatch& Batch : Batches)
+	{
+		FIntRect ScissorRect = Batch.ScissorRect;
+		ScissorRect.Clip(ViewportRect);
+		if (ScissorRect.IsEmpty())
+		{
+			continue;
+		}
+
+		// Textures that are not initialised yet are drawn white, which matches Slate behaviour for invalid brushes.
+		FImGuiPS::FParameters PixelParameters;
+		PixelParameters.Texture = Batch.Texture ? Batch.Texture.GetReference() : GWhiteTexture->TextureRHI.GetReference();
+		PixelParameters.TextureSampler = Batch.TextureSampler ? Batch.TextureSampler.GetReference()
+			: TStaticSamplerState<SF_Bilinear>::GetRHI();
+		SetShaderParameters(RHICmdList, PixelShader, PixelShader.GetPixelShader(), PixelParameters);
+
+		RHICmdList.SetScissorRect(true, ScissorRect.Min.X, ScissorRect.Min.Y, ScissorRect.Max.X, ScissorRect.Max.Y);
+		RHICmdList.DrawIndexedPrimitive(IndexBufferRHI, Batch.BaseVertexIndex, 0, Batch.NumVertices, Batch.StartIndex,
+			Batch.NumIndices / 3, 1);
+	}
+
+	RHICmdList.SetScissorRect(false, 0, 0, 0, 0);
+}
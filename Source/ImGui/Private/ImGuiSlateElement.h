@@ -0,0 +1,86 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include "ImGuiDrawData.h"
+#include "VersionCompatibility.h"
+
+#include <Rendering/RenderingCommon.h>
+#include <RHIResources.h>
+#include <Templates/SharedPointer.h>
+
+#include <imgui.h>
+
+
+class FTextureManager;
+
+// Custom Slate element drawing ImGui output with its own shaders. Vertices are uploaded in ImGui format (ImDrawVert) and
+// transformed on GPU, so there is no per-vertex conversion to Slate vertices.
+// Draw data are set on the game thread and read on the rendering thread, so they must not be changed after the element
+// is added to a Slate element list. To update, create a new element, or reuse this one if it is no longer referenced.
+class FImGuiSlateElement : public ICustomSlateElement, public TSharedFromThis<FImGuiSlateElement, ESPMode::ThreadSafe>
+{
+public:
+
+	// Copy draw data to this element. Draw lists and commands that are outside of the clipping rectangle are culled.
+	// @param DrawLists - Draw lists to draw
+	// @param ImGuiToScreen - Transform from ImGui to screen space (applied on GPU)
+	// @param ClippingRect - Clipping rectangle in screen space
+	// @param TextureManager - Texture manager used to find textures of draw commands
+	void SetDrawData(const TArray<FImGuiDrawList>& DrawLists, const FSlateRenderTransform& ImGuiToScreen, const FSlateRect& ClippingRect,
+		const FTextureManager& TextureManager);
+
+	//----------------------------------------------------------------------------------------------------
+	// ICustomSlateElement overrides
+	//----------------------------------------------------------------------------------------------------
+
+#if ENGINE_COMPATIBILITY_LEGACY_CUSTOM_SLATE_ELEMENT
+	virtual void DrawRenderThread(FRHICommandListImmediate& RHICmdList, const void* RenderTarget) override;
+#else
+	virtual void Draw_RenderThread(FRDGBuilder& GraphBuilder, const FDrawPassInputs& Inputs) override;
+#endif // ENGINE_COMPATIBILITY_LEGACY_CUSTOM_SLATE_ELEMENT
+
+private:
+
+	// Range of indices drawn with one texture and scissor rectangle.
+	struct FBatch
+	{
+		FIntRect ScissorRect;
+		FTextureRHIRef Texture;
+		FSamplerStateRHIRef TextureSampler;
+		int32 BaseVertexIndex = 0;
+		int32 NumVertices = 0;
+		int32 StartIndex = 0;
+		int32 NumIndices = 0;
+	};
+
+	void Draw(FRHICommandList& RHICmdList, const FIntPoint& ViewportSize) const;
+
+	TArray<ImDrawVert> VertexBuffer;
+	TArray<ImDrawIdx> IndexBuffer;
+	TArray<FBatch> Batches;
+	FSlateRenderTransform Transform;
+};
@@ -0,0 +1,289 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ImGuiWorldPrimitives.h"
+
+#include "ImGuiInteroperability.h"
+
+#include <Engine/LocalPlayer.h>
+#include <Engine/World.h>
+#include <SceneView.h>
+
+
+namespace
+{
+	// Minimal clip-space W of visible geometry. Lines are clipped against this plane rather than the actual near plane,
+	// which only needs to be in front of the view origin to avoid division by zero.
+	constexpr float MinClipW = 0.01f;
+
+	enum EOutcode : uint8
+	{
+		Outcode_Left = 1 << 0,
+		Outcode_Right = 1 << 1,
+		Outcode_Bottom = 1 << 2,
+		Outcode_Top = 1 << 3,
+		Outcode_Near = 1 << 4,
+	};
+
+	FORCEINLINE uint8 GetOutcode(const FVector4f& Clip)
+	{
+		return static_cast<uint8>((Clip.X < -Clip.W ? Outcode_Left : 0) | (Clip.X > Clip.W ? Outcode_Right : 0)
+			| (Clip.Y < -Clip.W ? Outcode_Bottom : 0) | (Clip.Y > Clip.W ? Outcode_Top : 0)
+			| (Clip.W < MinClipW ? Outcode_Near : 0));
+	}
+
+	// Map clip-space position to the display, with Y pointing down.
+	FORCEINLINE ImVec2 ToDisplay(const FVector4f& Clip, const ImVec2& HalfSize)
+	{
+		const float InvW = 1.f / Clip.W;
+		return ImVec2{ (1.f + Clip.X * InvW) * HalfSize.x, (1.f - Clip.Y * InvW) * HalfSize.y };
+	}
+
+	// Clip the end point of a line against the MinClipW plane. Start point needs to be in front of that plane.
+	FORCEINLINE FVector4f ClipToNearPlane(const FVector4f& Start, const FVector4f& End)
+	{
+		const float Alpha = (Start.W - MinClipW) / (Start.W - End.W);
+		return FMath::Lerp(Start, End, Alpha);
+	}
+}
+
+void FImGuiWorldPrimitives::Reset()
+{
+	Positions.Reset();
+	Edges.Reset();
+	Points.Reset();
+	Labels.Reset();
+}
+
+void FImGuiWorldPrimitives::AddLine(const FVector& Start, const FVector& End, const FColor& Color, float Thickness)
+{
+	const int32 First = Positions.Add(Start);
+	Positions.Add(End);
+	Edges.Add({ First, First + 1, Color, Thickness });
+}
+
+void FImGuiWorldPrimitives::AddLines(TArrayView<const FVector> InPoints, const FColor& Color, float Thickness)
+{
+	const int32 NumLines = InPoints.Num() / 2;
+	const int32 First = Positions.Num();
+
+	Positions.Append(InPoints.GetData(), NumLines * 2);
+	Edges.Reserve(Edges.Num() + NumLines);
+	for (int32 LineIndex = 0; LineIndex < NumLines; LineIndex++)
+	{
+		Edges.Add({ First + LineIndex * 2, First + LineIndex * 2 + 1, Color, Thickness });
+	}
+}
+
+void FImGuiWorldPrimitives::AddPoint(const FVector& Position, const FColor& Color, float Size)
+{
+	Points.Add({ Positions.Add(Position), Color, Size });
+}
+
+void FImGuiWorldPrimitives::AddPoints(TArrayView<const FVector> InPositions, const FColor& Color, float Size)
+{
+	const int32 First = Positions.Num();
+
+	Positions.Append(InPositions.GetData(), InPositions.Num());
+	Points.Reserve(Points.Num() + InPositions.Num());
+	for (int32 Index = 0; Index < InPositions.Num(); Index++)
+	{
+		Points.Add({ First + Index, Color, Size });
+	}
+}
+
+void FImGuiWorldPrimitives::AddBox(const FBox& Box, const FColor& Color, float Thickness)
+{
+	// Corner index bits select max X, Y and Z respectively.
+	const int32 First = Positions.Num();
+	for (int32 Corner = 0; Corner < 8; Corner++)
+	{
+		Positions.Add(FVector{ (Corner & 1) ? Box.Max.X : Box.Min.X, (Corner & 2) ? Box.Max.Y : Box.Min.Y,
+			(Corner & 4) ? Box.Max.Z : Box.Min.Z });
+	}
+
+	// Every edge connects two corners that differ in one bit.
+	for (int32 Corner = 0; Corner < 8; Corner++)
+	{
+		for (int32 Bit = 1; Bit < 8; Bit <<= 1)
+		{
+			if (!(Corner & Bit))
+			{
+				Edges.Add({ First + Corner, First + (Corner | Bit), Color, Thickness });
+			}
+		}
+	}
+}
+
+void FImGuiWorldPrimitives::AddLabel(const FVector& Position, const FString& Text, const FColor& Color)
+{
+	Labels.Add({ Positions.Add(Position), Color, Text });
+}
+
+void FImGuiWorldPrimitives::ProjectPositions(const FMatrix& ViewProjection, const FVector& ViewOrigin) const
+{
+	// Positions are translated to the view origin in double precision, so the rest can be done in single precision.
+	const FMatrix44f Matrix{ FTranslationMatrix(ViewOrigin) * ViewProjection };
+	const VectorRegister4Float Row0 = VectorLoad(Matrix.M[0]);
+	const VectorRegister4Float Row1 = VectorLoad(Matrix.M[1]);
+	const VectorRegister4Float Row2 = VectorLoad(Matrix.M[2]);
+	const VectorRegister4Float Row3 = VectorLoad(Matrix.M[3]);
+
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4)
+	ClipPositions.SetNumUninitialized(Positions.Num(), EAllowShrinking::No);
+#else
+	ClipPositions.SetNumUninitialized(Positions.Num(), false);
+#endif
+
+	const FVector* Position = Positions.GetData();
+	FVector4f* Clip = ClipPositions.GetData();
+	for (const FVector* PositionEnd = Position + Positions.Num(); Position < PositionEnd; Position++, Clip++)
+	{
+		const FVector3f Local{ *Position - ViewOrigin };
+		VectorRegister4Float Result = VectorMultiplyAdd(VectorSetFloat1(Local.Z), Row2, Row3);
+		Result = VectorMultiplyAdd(VectorSetFloat1(Local.Y), Row1, Result);
+		Result = VectorMultiplyAdd(VectorSetFloat1(Local.X), Row0, Result);
+		VectorStore(Result, &Clip->X);
+	}
+}
+
+int32 FImGuiWorldPrimitives::Draw(ImDrawList* DrawList, const FMatrix& ViewProjection, const FVector& ViewOrigin,
+	const FVector2D& DisplaySize) const
+{
+	check(DrawList);
+
+	if (Positions.Num() == 0)
+	{
+		return 0;
+	}
+
+	ProjectPositions(ViewProjection, ViewOrigin);
+
+	const ImVec2 HalfSize = ImGuiInterops::ToImVec2(DisplaySize * 0.5);
+
+	Quads.Reset();
+
+	for (const FEdge& Edge : Edges)
+	{
+		FVector4f Start = ClipPositions[Edge.Start];
+		FVector4f End = ClipPositions[Edge.End];
+
+		const uint8 StartOutcode = GetOutcode(Start);
+		const uint8 EndOutcode = GetOutcode(End);
+
+		// Both ends outside of the same plane.
+		if (StartOutcode & EndOutcode)
+		{
+			continue;
+		}
+
+		if (StartOutcode & Outcode_Near)
+		{
+			Start = ClipToNearPlane(End, Start);
+		}
+		else if (EndOutcode & Outcode_Near)
+		{
+			End = ClipToNearPlane(Start, End);
+		}
+
+		const ImVec2 A = ToDisplay(Start, HalfSize);
+		const ImVec2 B = ToDisplay(End, HalfSize);
+
+		// Extrude line along its normal. Degenerate lines are skipped.
+		const ImVec2 Direction{ B.x - A.x, B.y - A.y };
+		const float LengthSquared = Direction.x * Direction.x + Direction.y * Direction.y;
+		if (LengthSquared > 0.f)
+		{
+			const float Scale = 0.5f * Edge.Thickness * FMath::InvSqrt(LengthSquared);
+			const ImVec2 Normal{ -Direction.y * Scale, Direction.x * Scale };
+			Quads.Add({ { ImVec2{ A.x + Normal.x, A.y + Normal.y }, ImVec2{ B.x + Normal.x, B.y + Normal.y },
+				ImVec2{ B.x - Normal.x, B.y - Normal.y }, ImVec2{ A.x - Normal.x, A.y - Normal.y } },
+				ImGuiInterops::PackImU32Color(Edge.Color) });
+		}
+	}
+
+	for (const FPoint& Point : Points)
+	{
+		const FVector4f& Clip = ClipPositions[Point.Position];
+		if (GetOutcode(Clip) == 0)
+		{
+			const ImVec2 Center = ToDisplay(Clip, HalfSize);
+			const float Extent = 0.5f * Point.Size;
+			Quads.Add({ { ImVec2{ Center.x - Extent, Center.y - Extent }, ImVec2{ Center.x + Extent, Center.y - Extent },
+				ImVec2{ Center.x + Extent, Center.y + Extent }, ImVec2{ Center.x - Extent, Center.y + Extent } },
+				ImGuiInterops::PackImU32Color(Point.Color) });
+		}
+	}
+
+	// Without vertex offsets, every draw list is limited by the range of its indices.
+	int32 NumQuads = Quads.Num();
+	if (sizeof(ImDrawIdx) == 2)
+	{
+		NumQuads = FMath::Min(NumQuads, static_cast<int32>((0x10000 - DrawList->_VtxCurrentIdx) / 4));
+	}
+
+	if (NumQuads > 0)
+	{
+		const ImVec2 WhitePixel = ImGui::GetFontTexUvWhitePixel();
+
+		DrawList->PrimReserve(NumQuads * 6, NumQuads * 4);
+		for (int32 QuadIndex = 0; QuadIndex < NumQuads; QuadIndex++)
+		{
+			const FQuad& Quad = Quads[QuadIndex];
+			DrawList->PrimQuadUV(Quad.Corners[0], Quad.Corners[1], Quad.Corners[2], Quad.Corners[3],
+				WhitePixel, WhitePixel, WhitePixel, WhitePixel, Quad.Color);
+		}
+	}
+
+	int32 NumLabels = 0;
+	for (const FLabel& Label : Labels)
+	{
+		const FVector4f& Clip = ClipPositions[Label.Position];
+		if (GetOutcode(Clip) == 0)
+		{
+			DrawList->AddText(ToDisplay(Clip, HalfSize), ImGuiInterops::PackImU32Color(Label.Color), TCHAR_TO_UTF8(*Label.Text));
+			NumLabels++;
+		}
+	}
+
+	return NumQuads + NumLabels;
+}
+
+int32 FImGuiWorldPrimitives::Draw(const UWorld* World) const
+{
+	const ULocalPlayer* LocalPlayer = World ? World->GetFirstLocalPlayerFromController() : nullptr;
+	if (!LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->ViewportClient->Viewport)
+	{
+		return 0;
+	}
+
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+	{
+		return 0;
+	}
+
+	return Draw(ImGui::GetBackgroundDrawList(), ProjectionData.ComputeViewProjectionMatrix(), ProjectionData.ViewOrigin,
+		ImGuiInterops::ToVector2D(ImGui::GetIO().DisplaySize));
+}
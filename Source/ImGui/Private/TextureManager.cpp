@@ -30,6 +30,20 @@
 #include <algorithm>
 
 
+namespace
+{
+	void UpdateTextureData(UTexture2D* Texture, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup)
+	{
+		FUpdateTextureRegion2D* TextureRegion = new FUpdateTextureRegion2D(0, 0, 0, 0, Width, Height);
+		auto DataCleanup = [SrcDataCleanup](uint8* Data, const FUpdateTextureRegion2D* UpdateRegion)
+		{
+			SrcDataCleanup(Data);
+			delete UpdateRegion;
+		};
+		Texture->UpdateTextureRegions(0, 1u, TextureRegion, SrcBpp * Width, SrcBpp, SrcData, DataCleanup);
+	}
+}
+
 void FTextureManager::InitializeErrorTexture(const FColor& Color)
 {
 	CreatePlainTextureInternal(NAME_ErrorTexture, 2, 2, Color);
@@ -42,6 +56,27 @@ TextureIndex FTextureManager::CreateTexture(const FName& Name, int32 Width, int3
 	return CreateTextureInternal(Name, Width, Height, SrcBpp, SrcData, SrcDataCleanup);
 }
 
+TextureIndex FTextureManager::UpdateTexture(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup, bool bNearestFilter)
+{
+	checkf(Name != NAME_None, TEXT("Trying to update a texture with a name 'NAME_None' is not allowed."));
+
+	// Reuse our own texture, if it exists and has the right size.
+	const TextureIndex Index = FindTextureIndex(Name);
+	if (Index != INDEX_NONE)
+	{
+		UTexture2D* Texture = Cast<UTexture2D>(TextureResources[Index].GetOwnedTexture());
+		if (Texture && Texture->GetSizeX() == Width && Texture->GetSizeY() == Height)
+		{
+			UpdateTextureData(Texture, Width, Height, SrcBpp, SrcData, SrcDataCleanup);
+			TextureResources[Index].SetRevision(++LastRevision);
+			return Index;
+		}
+	}
+
+	// Otherwise create a new texture. Entry with the same name will be reused.
+	return CreateTextureInternal(Name, Width, Height, SrcBpp, SrcData, SrcDataCleanup, bNearestFilter);
+}
+
 TextureIndex FTextureManager::CreatePlainTexture(const FName& Name, int32 Width, int32 Height, FColor Color)
 {
 	checkf(Name != NAME_None, TEXT("Trying to create a texture with a name 'NAME_None' is not allowed."));
@@ -63,24 +98,23 @@ void FTextureManager::ReleaseTextureResources(TextureIndex Index)
 	checkf(IsInRange(Index), TEXT("Invalid texture index %d. Texture resources array has %d entries total."), Index, TextureResources.Num());
 
 	TextureResources[Index] = {};
+	++LastRevision;
 }
 
-TextureIndex FTextureManager::CreateTextureInternal(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup)
+TextureIndex FTextureManager::CreateTextureInternal(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup, bool bNearestFilter)
 {
 	// Create a texture.
 	UTexture2D* Texture = UTexture2D::CreateTransient(Width, Height);
+	if (bNearestFilter)
+	{
+		Texture->Filter = TF_Nearest;
+	}
 
 	// Create a new resource for that texture.
 	Texture->UpdateResource();
 
 	// Update texture data.
-	FUpdateTextureRegion2D* TextureRegion = new FUpdateTextureRegion2D(0, 0, 0, 0, Width, Height);
-	auto DataCleanup = [SrcDataCleanup](uint8* Data, const FUpdateTextureRegion2D* UpdateRegion)
-	{
-		SrcDataCleanup(Data);
-		delete UpdateRegion;
-	};
-	Texture->UpdateTextureRegions(0, 1u, TextureRegion, SrcBpp * Width, SrcBpp, SrcData, DataCleanup);
+	UpdateTextureData(Texture, Width, Height, SrcBpp, SrcData, SrcDataCleanup);
 
 	// Create an entry for the texture.
 	if (Name == NAME_ErrorTexture)
@@ -124,12 +158,14 @@ TextureIndex FTextureManager::AddTextureEntry(const FName& Name, UTexture* Textu
 	if (Index != INDEX_NONE)
 	{
 		TextureResources[Index] = { Name, Texture, bAddToRoot };
-		return Index;
 	}
 	else
 	{
-		return TextureResources.Emplace(Name, Texture, bAddToRoot);
+		Index = TextureResources.Emplace(Name, Texture, bAddToRoot);
 	}
+
+	TextureResources[Index].SetRevision(++LastRevision);
+	return Index;
 }
 
 FTextureManager::FTextureEntry::FTextureEntry(const FName& InName, UTexture* InTexture, bool bAddToRoot)
@@ -165,6 +201,7 @@ FTextureManager::FTextureEntry& FTextureManager::FTextureEntry::operator=(FTextu
 	Texture = MoveTemp(Other.Texture);
 	Brush = MoveTemp(Other.Brush);
 	CachedResourceHandle = MoveTemp(Other.CachedResourceHandle);
+	Revision = Other.Revision;
 
 	// Reset the other entry (without releasing resources which are already moved to this instance) to remove tracks
 	// of ownership and mark it as empty/reusable.
@@ -182,6 +219,11 @@ const FSlateResourceHandle& FTextureManager::FTextureEntry::GetResourceHandle()
 	return CachedResourceHandle;
 }
 
+UTexture* FTextureManager::FTextureEntry::GetTexture() const
+{
+	return Cast<UTexture>(Brush.GetResourceObject());
+}
+
 void FTextureManager::FTextureEntry::Reset(bool bReleaseResources)
 {
 	if (bReleaseResources)
@@ -207,4 +249,5 @@ void FTextureManager::FTextureEntry::Reset(bool bReleaseResources)
 	Texture.Reset();
 	Brush = FSlateNoResource();
 	CachedResourceHandle = FSlateResourceHandle();
+	Revision = 0;
 }
@@ -84,6 +84,26 @@ public:
 		return IsValidTexture(Index) ? TextureResources[Index].GetResourceHandle() : ErrorTexture.GetResourceHandle();
 	}
 
+	// Get the texture at given index. If index is out of range or resources are not valid it returns the error texture.
+	// @param Index - Index of a texture
+	// @returns The texture at given index or the error texture, if no valid resources were found at given index
+	UTexture* GetTexture(TextureIndex Index) const
+	{
+		return IsValidTexture(Index) ? TextureResources[Index].GetTexture() : ErrorTexture.GetTexture();
+	}
+
+	// Get the revision of a texture at given index. Revision changes whenever texture or its content is replaced, so it
+	// can be used to detect textures updated in place under the same index.
+	// @param Index - Index of a texture
+	// @returns The revision of a texture at given index or 0, if no valid resources were found at given index
+	uint32 GetTextureRevision(TextureIndex Index) const
+	{
+		return IsValidTexture(Index) ? TextureResources[Index].GetRevision() : 0;
+	}
+
+	// Get the revision of the last change made to any texture.
+	uint32 GetRevision() const { return LastRevision; }
+
 	// Create a texture from raw data.
 	// @param Name - The texture name
 	// @param Width - The texture width
@@ -94,6 +114,18 @@ public:
 	// @returns The index of a texture that was created
 	TextureIndex CreateTexture(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup = [](uint8*) {});
 
+	// Create a texture from raw data or update the texture created with the same name. Existing texture is reused if it
+	// has the same size, otherwise it is replaced in place, so the index stays valid.
+	// @param Name - The texture name
+	// @param Width - The texture width
+	// @param Height - The texture height
+	// @param SrcBpp - The size in bytes of one pixel
+	// @param SrcData - The source data
+	// @param SrcDataCleanup - Function called to release source data after texture is updated
+	// @param bNearestFilter - Whether texture should be sampled without filtering (e.g. for data visualisation)
+	// @returns The index of a texture that was created or updated
+	TextureIndex UpdateTexture(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup, bool bNearestFilter = false);
+
 	// Create a plain texture.
 	// @param Name - The texture name
 	// @param Width - The texture width
@@ -117,7 +149,7 @@ private:
 	// See CreateTexture for general description.
 	// Internal implementations doesn't validate name or resource uniqueness. Instead it uses NAME_ErrorTexture
 	// (aka NAME_None) and INDEX_ErrorTexture (aka INDEX_NONE) to identify ErrorTexture.
-	TextureIndex CreateTextureInternal(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup = [](uint8*) {});
+	TextureIndex CreateTextureInternal(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup = [](uint8*) {}, bool bNearestFilter = false);
 
 	// See CreatePlainTexture for general description.
 	// Internal implementations doesn't validate name or resource uniqueness. Instead it uses NAME_ErrorTexture
@@ -162,6 +194,15 @@ private:
 		const FName& GetName() const { return Name; }
 		const FSlateResourceHandle& GetResourceHandle() const;
 
+		// Get texture used by this entry (owned or managed externally).
+		UTexture* GetTexture() const;
+
+		// Get texture owned by this entry or null, if texture is managed externally.
+		UTexture* GetOwnedTexture() const { return Texture.Get(); }
+
+		uint32 GetRevision() const { return Revision; }
+		void SetRevision(uint32 InRevision) { Revision = InRevision; }
+
 	private:
 
 		void Reset(bool bReleaseResources);
@@ -170,11 +211,15 @@ private:
 		mutable FSlateResourceHandle CachedResourceHandle;
 		TWeakObjectPtr<UTexture> Texture;
 		FSlateBrush Brush;
+		uint32 Revision = 0;
 	};
 
 	TArray<FTextureEntry> TextureResources;
 	FTextureEntry ErrorTexture;
 
+	// Revision assigned to the last created or updated texture.
+	uint32 LastRevision = 0;
+
 	static constexpr EName NAME_ErrorTexture = NAME_None;
 	static constexpr TextureIndex INDEX_ErrorTexture = INDEX_NONE;
 };
@@ -58,3 +58,12 @@
 #define ENGINE_COMPATIBILITY_LEGACY_KEY_AXIS_API        BELOW_ENGINE_VERSION(4, 26)
 
 #define ENGINE_COMPATIBILITY_LEGACY_VECTOR2F            BELOW_ENGINE_VERSION(5, 0)
+
+// Starting from version 5.0, thread-safe FTSTicker replaces FTicker as the core ticker.
+#define ENGINE_COMPATIBILITY_LEGACY_CORE_TICKER         BELOW_ENGINE_VERSION(5, 0)
+
+// Starting from version 5.1, FProperty::ExportTextItem is replaced by ExportTextItem_Direct and ExportTextItem_InContainer.
+#define ENGINE_COMPATIBILITY_LEGACY_EXPORT_TEXT_ITEM    BELOW_ENGINE_VERSION(5, 1)
+
+// Starting from version 5.4, custom Slate elements are drawn in render graph passes.
+#define ENGINE_COMPATIBILITY_LEGACY_CUSTOM_SLATE_ELEMENT BELOW_ENGINE_VERSION(5, 4)
@@ -32,6 +32,8 @@
 #include "ImGuiInteroperability.h"
 #include "ImGuiModuleManager.h"
 #include "ImGuiModuleSettings.h"
+#include "ImGuiRenderTarget.h"
+#include "ImGuiSlateElement.h"
 #include "TextureManager.h"
 #include "Utilities/Arrays.h"
 #include "VersionCompatibility.h"
@@ -128,6 +130,8 @@ void SImGuiWidget::Construct(const FArguments& InArgs)
 	// Get initial settings.
 	const auto& Settings = ModuleManager->GetSettings();
 	SetHideMouseCursor(Settings.UseSoftwareCursor());
+	SetComposeInRenderTarget(Settings.ShouldComposeInRenderTarget());
+	SetUseCustomSlateElement(Settings.ShouldUseCustomSlateElement());
 	CreateInputHandler(Settings.GetImGuiInputHandlerClass());
 	SetDPIScale(Settings.GetDPIScaleInfo());
 	SetCanvasSizeInfo(Settings.GetCanvasSizeInfo());
@@ -176,6 +180,20 @@ void SImGuiWidget::Tick(const FGeometry& AllottedGeometry, const double InCurren
 	UpdateTransparentMouseInput(AllottedGeometry);
 	HandleWindowFocusLost();
 	UpdateCanvasSize();
+
+	// Render target is drawn with a separate Slate render, so it is updated here instead of being nested in OnPaint.
+	if (RenderTarget.IsValid())
+	{
+		if (FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+		{
+			// Context is ticked only once per frame, so this gets output of the current frame and OnPaint presents it.
+			ContextProxy->Tick(FSlateApplication::Get().GetDeltaTime());
+
+			// Render target is drawn with the same scale as the ImGui to screen transform to keep it pixel-perfect.
+			const FSlateRenderTransform ImGuiToScreen = ImGuiRenderTransform.Concatenate(AllottedGeometry.GetAccumulatedRenderTransform());
+			RenderTarget->Update(*ContextProxy, ImGuiToScreen.TransformVector(FVector2D(1.f, 0.f)).Size());
+		}
+	}
 }
 
 FReply SImGuiWidget::OnKeyChar(const FGeometry& MyGeometry, const FCharacterEvent& CharacterEvent)
@@ -332,6 +350,14 @@ void SImGuiWidget::RegisterImGuiSettingsDelegates()
 	{
 		Settings.OnUseSoftwareCursorChanged.AddRaw(this, &SImGuiWidget::SetHideMouseCursor);
 	}
+	if (!Settings.OnComposeInRenderTargetChangedDelegate.IsBoundToObject(this))
+	{
+		Settings.OnComposeInRenderTargetChangedDelegate.AddRaw(this, &SImGuiWidget::SetComposeInRenderTarget);
+	}
+	if (!Settings.OnUseCustomSlateElementChangedDelegate.IsBoundToObject(this))
+	{
+		Settings.OnUseCustomSlateElementChangedDelegate.AddRaw(this, &SImGuiWidget::SetUseCustomSlateElement);
+	}
 	if (!Settings.OnDPIScaleChangedDelegate.IsBoundToObject(this))
 	{
 		Settings.OnDPIScaleChangedDelegate.AddRaw(this, &SImGuiWidget::SetDPIScale);
@@ -348,6 +374,8 @@ void SImGuiWidget::UnregisterImGuiSettingsDelegates()
 
 	Settings.OnImGuiInputHandlerClassChanged.RemoveAll(this);
 	Settings.OnUseSoftwareCursorChanged.RemoveAll(this);
+	Settings.OnComposeInRenderTargetChangedDelegate.RemoveAll(this);
+	Settings.OnUseCustomSlateElementChangedDelegate.RemoveAll(this);
 	Settings.OnDPIScaleChangedDelegate.RemoveAll(this);
 	Settings.OnCanvasSizeChangedDelegate.RemoveAll(this);
 }
@@ -361,6 +389,33 @@ void SImGuiWidget::SetHideMouseCursor(bool bHide)
 	}
 }
 
+void SImGuiWidget::SetComposeInRenderTarget(bool bCompose)
+{
+	if (bCompose && !RenderTarget.IsValid())
+	{
+		RenderTarget = MakeUnique<FImGuiRenderTarget>(ModuleManager->GetTextureManager());
+	}
+	else if (!bCompose && RenderTarget.IsValid())
+	{
+		RenderTarget.Reset();
+
+		// Cached draw data are not updated while composing in the render target.
+		CachedContextProxy = nullptr;
+	}
+}
+
+void SImGuiWidget::SetUseCustomSlateElement(bool bUse)
+{
+	if (bUseCustomSlateElement != bUse)
+	{
+		bUseCustomSlateElement = bUse;
+		SlateElement.Reset();
+
+		// Both paths share the key of cached draw data, so force an update after switching.
+		CachedContextProxy = nullptr;
+	}
+}
+
 bool SImGuiWidget::IsConsoleOpened() const
 {
 	return GameViewport->ViewportConsole && GameViewport->ViewportConsole->ConsoleState != NAME_None;
@@ -653,6 +708,93 @@ FVector2D SImGuiWidget::TransformScreenPointToImGui(const FGeometry& MyGeometry,
 	return ImGuiToScreen.Inverse().TransformPoint(Point);
 }
 
+void SImGuiWidget::UpdateCachedDrawData(const FImGuiContextProxy& ContextProxy, const FSlateRenderTransform& ImGuiToScreen,
+	const FSlateRect& MyClippingRect) const
+{
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	// Convert clipping rectangle to format required by Slate vertex.
+	const FSlateRotatedRect VertexClippingRect{ MyClippingRect };
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+	PaintStats = {};
+	NumCachedDrawBatches = 0;
+
+	const TArray<FImGuiDrawList>& DrawLists = ContextProxy.GetDrawData();
+
+	// Skip whole lists, if nothing that they draw can be visible. With canvas larger than the viewport, this is common
+	// and it saves us from testing their commands one by one.
+	TArray<bool, TInlineAllocator<64>> VisibleDrawLists;
+	VisibleDrawLists.SetNumUninitialized(DrawLists.Num());
+	for (int32 DrawListIndex = 0; DrawListIndex < DrawLists.Num(); DrawListIndex++)
+	{
+		const FImGuiDrawList& DrawList = DrawLists[DrawListIndex];
+		PaintStats.NumDrawLists++;
+		PaintStats.NumCommands += DrawList.NumCommands();
+		PaintStats.NumVertices += DrawList.NumVertices();
+
+		VisibleDrawLists[DrawListIndex] = FSlateRect::DoRectanglesIntersect(DrawList.GetClippingBounds(ImGuiToScreen), MyClippingRect);
+		if (!VisibleDrawLists[DrawListIndex])
+		{
+			PaintStats.NumCulledDrawLists++;
+			PaintStats.NumCulledCommands += DrawList.NumCommands();
+			PaintStats.NumCulledVertices += DrawList.NumVertices();
+		}
+	}
+
+	// Convert batches of commands that share a texture and clipping, so they can be drawn as single elements.
+	const FImGuiDrawBatches& DrawBatches = ContextProxy.GetDrawBatches();
+	for (const FImGuiDrawBatch& DrawBatch : DrawBatches.GetBatches())
+	{
+		// Transform clipping rectangle to screen space and apply to elements that we draw.
+		bool bOverlapping = false;
+		const FSlateRect ClippingRect = TransformRect(ImGuiToScreen, DrawBatch.ClippingRect).IntersectionWith(MyClippingRect, bOverlapping);
+
+		FCachedDrawBatch* CachedBatch = nullptr;
+		for (int32 CommandNb = DrawBatch.FirstCommand; CommandNb < DrawBatch.FirstCommand + DrawBatch.NumCommands; CommandNb++)
+		{
+			const FImGuiBatchedCommand& Command = DrawBatches.GetCommands()[CommandNb];
+			if (!VisibleDrawLists[Command.DrawListIndex])
+			{
+				continue;
+			}
+
+			// Skip commands that are completely clipped. Batch clipping rectangle can be larger than clipping
+			// rectangles of its commands, so each of them needs to be tested.
+			const FImGuiDrawList& DrawList = DrawLists[Command.DrawListIndex];
+			if (!bOverlapping || !FSlateRect::DoRectanglesIntersect(DrawList.GetCommand(Command.CommandIndex, ImGuiToScreen).ClippingRect, MyClippingRect))
+			{
+				PaintStats.NumCulledCommands++;
+				PaintStats.NumCulledIndices += Command.NumIndices;
+				continue;
+			}
+
+			if (!CachedBatch)
+			{
+				if (NumCachedDrawBatches == CachedDrawBatches.Num())
+				{
+					CachedDrawBatches.AddDefaulted();
+				}
+				CachedBatch = &CachedDrawBatches[NumCachedDrawBatches++];
+				CachedBatch->VertexBuffer.Reset();
+				CachedBatch->IndexBuffer.Reset();
+				CachedBatch->ClippingRect = ClippingRect;
+				CachedBatch->TextureId = DrawBatch.TextureId;
+			}
+
+			// Only vertices used by this command are copied, so indices need to be moved to their new position.
+			const int32 IndexOffset = CachedBatch->VertexBuffer.Num() - Command.FirstVertex;
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+			DrawList.AppendVertexData(CachedBatch->VertexBuffer, Command.FirstVertex, Command.NumVertices, ImGuiToScreen, VertexClippingRect);
+#else
+			DrawList.AppendVertexData(CachedBatch->VertexBuffer, Command.FirstVertex, Command.NumVertices, ImGuiToScreen);
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+			DrawList.AppendIndexData(CachedBatch->IndexBuffer, Command.StartIndex, Command.NumIndices, IndexOffset);
+		}
+	}
+
+	PaintStats.NumBatches = NumCachedDrawBatches;
+}
+
 int32 SImGuiWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect,
 	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& WidgetStyle, bool bParentEnabled) const
 {
@@ -667,50 +809,79 @@ int32 SImGuiWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeo
 		const FSlateRenderTransform& WidgetToScreen = AllottedGeometry.GetAccumulatedRenderTransform();
 		const FSlateRenderTransform ImGuiToScreen = RoundTranslation(ImGuiRenderTransform.Concatenate(WidgetToScreen));
 
-#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-		// Convert clipping rectangle to format required by Slate vertex.
-		const FSlateRotatedRect VertexClippingRect{ MyClippingRect };
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+		if (RenderTarget.IsValid())
+		{
+			// Present the render target, updated in Tick, as a single quad.
+			RenderTarget->Paint(OutDrawElements, LayerId, ImGuiToScreen, MyClippingRect);
+			return Super::OnPaint(Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, WidgetStyle, bParentEnabled);
+		}
 
-		for (const auto& DrawList : ContextProxy->GetDrawData())
+		if (bUseCustomSlateElement)
 		{
-#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-			DrawList.CopyVertexData(VertexBuffer, ImGuiToScreen, VertexClippingRect);
-#else
-			DrawList.CopyVertexData(VertexBuffer, ImGuiToScreen);
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+			// Copy draw data only if the output or its placement changed. The element is read on the rendering thread,
+			// so if it is still referenced by a previous frame, a new one is created instead of updating it in place.
+			if (ContextProxy != CachedContextProxy || ContextProxy->GetDrawDataVersion() != CachedDrawDataVersion
+				|| ImGuiToScreen != CachedImGuiToScreen || MyClippingRect != CachedClippingRect || !SlateElement.IsValid())
+			{
+				if (!SlateElement.IsValid() || !SlateElement.IsUnique())
+				{
+					SlateElement = MakeShared<FImGuiSlateElement, ESPMode::ThreadSafe>();
+				}
+				SlateElement->SetDrawData(ContextProxy->GetDrawData(), ImGuiToScreen, MyClippingRect, ModuleManager->GetTextureManager());
 
-			int IndexBufferOffset = 0;
-			for (int CommandNb = 0; CommandNb < DrawList.NumCommands(); CommandNb++)
+				CachedContextProxy = ContextProxy;
+				CachedDrawDataVersion = ContextProxy->GetDrawDataVersion();
+				CachedImGuiToScreen = ImGuiToScreen;
+				CachedClippingRect = MyClippingRect;
+				NumPaintsSinceConversion = 0;
+			}
+			else
 			{
-				const auto& DrawCommand = DrawList.GetCommand(CommandNb, ImGuiToScreen);
+				NumPaintsSinceConversion++;
+			}
 
-				DrawList.CopyIndexData(IndexBuffer, IndexBufferOffset, DrawCommand.NumElements);
+			FSlateDrawElement::MakeCustom(OutDrawElements, LayerId, SlateElement);
+			return Super::OnPaint(Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, WidgetStyle, bParentEnabled);
+		}
 
-				// Advance offset by number of copied elements to position it for the next command.
-				IndexBufferOffset += DrawCommand.NumElements;
+		// Only convert draw data if the output or its placement changed. Otherwise present the cached geometry again.
+		if (ContextProxy != CachedContextProxy || ContextProxy->GetDrawDataVersion() != CachedDrawDataVersion
+			|| ImGuiToScreen != CachedImGuiToScreen || MyClippingRect != CachedClippingRect)
+		{
+			UpdateCachedDrawData(*ContextProxy, ImGuiToScreen, MyClippingRect);
+
+			CachedContextProxy = ContextProxy;
+			CachedDrawDataVersion = ContextProxy->GetDrawDataVersion();
+			CachedImGuiToScreen = ImGuiToScreen;
+			CachedClippingRect = MyClippingRect;
+			NumPaintsSinceConversion = 0;
+		}
+		else
+		{
+			NumPaintsSinceConversion++;
+		}
 
-				// Get texture resource handle for this draw command (null index will be also mapped to a valid texture).
-				const FSlateResourceHandle& Handle = ModuleManager->GetTextureManager().GetTextureHandle(DrawCommand.TextureId);
+		for (int32 BatchNb = 0; BatchNb < NumCachedDrawBatches; BatchNb++)
+		{
+			const FCachedDrawBatch& DrawBatch = CachedDrawBatches[BatchNb];
 
-				// Transform clipping rectangle to screen space and apply to elements that we draw.
-				const FSlateRect ClippingRect = DrawCommand.ClippingRect.IntersectionWith(MyClippingRect);
+			// Get texture resource handle for this batch (null index will be also mapped to a valid texture).
+			const FSlateResourceHandle& Handle = ModuleManager->GetTextureManager().GetTextureHandle(DrawBatch.TextureId);
 
 #if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-				// Get access to the Slate scissor rectangle defined in Slate Core API, so we can customize elements drawing.
-				extern SLATECORE_API TOptional<FShortRect> GSlateScissorRect;
-				TGuardValue<TOptional<FShortRect>> GSlateScissorRecGuard(GSlateScissorRect, FShortRect{ ClippingRect });
+			// Get access to the Slate scissor rectangle defined in Slate Core API, so we can customize elements drawing.
+			extern SLATECORE_API TOptional<FShortRect> GSlateScissorRect;
+			TGuardValue<TOptional<FShortRect>> GSlateScissorRecGuard(GSlateScissorRect, FShortRect{ DrawBatch.ClippingRect });
 #else
-				OutDrawElements.PushClip(FSlateClippingZone{ ClippingRect });
+			OutDrawElements.PushClip(FSlateClippingZone{ DrawBatch.ClippingRect });
 #endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 
-				// Add elements to the list.
-				FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, VertexBuffer, IndexBuffer, nullptr, 0, 0);
+			// Add elements to the list.
+			FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, DrawBatch.VertexBuffer, DrawBatch.IndexBuffer, nullptr, 0, 0);
 
 #if !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-				OutDrawElements.PopClip();
+			OutDrawElements.PopClip();
 #endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-			}
 		}
 	}
 
@@ -899,6 +1070,54 @@ void SImGuiWidget::OnDebugDraw()
 				TwoColumns::Value("ImGui Scale", ContextProxy ? ContextProxy->GetDPIScale() : 1.f);
 			});
 
+			TwoColumns::CollapsingGroup("Culling", [&]()
+			{
+				TwoColumns::Value("Draw Lists", PaintStats.NumDrawLists);
+				TwoColumns::Value("Culled Draw Lists", PaintStats.NumCulledDrawLists);
+				TwoColumns::Value("Commands", PaintStats.NumCommands);
+				TwoColumns::Value("Culled Commands", PaintStats.NumCulledCommands);
+				TwoColumns::Value("Vertices", PaintStats.NumVertices);
+				TwoColumns::Value("Culled Vertices", PaintStats.NumCulledVertices);
+				TwoColumns::Value("Culled Indices", PaintStats.NumCulledIndices);
+				TwoColumns::Value("Visible Commands", PaintStats.NumCommands - PaintStats.NumCulledCommands);
+				TwoColumns::Value("Batches", PaintStats.NumBatches);
+				TwoColumns::Value("Paints Since Conversion", NumPaintsSinceConversion);
+			});
+
+			if (RenderTarget.IsValid())
+			{
+				TwoColumns::CollapsingGroup("Render Target", [&]()
+				{
+					const FImGuiRenderTarget::FUpdateStats& UpdateStats = RenderTarget->GetUpdateStats();
+					TwoColumns::ValueWidthHeight("Size", FVector2D{ RenderTarget->GetSize() });
+					TwoColumns::Value("Dirty Rects", UpdateStats.NumDirtyRects);
+					TwoColumns::Value("Redrawn Draw Lists", UpdateStats.NumRedrawnDrawLists);
+					TwoColumns::Value("Redrawn Vertices", UpdateStats.NumRedrawnVertices);
+				});
+			}
+
+			if (ContextProxy)
+			{
+				TwoColumns::CollapsingGroup("Update", [&]()
+				{
+					TwoColumns::Value("Target Update Rate", ContextProxy->GetTargetUpdateRate());
+					TwoColumns::Value("Draw Data Version", ContextProxy->GetDrawDataVersion());
+				});
+			}
+
+			if (ContextProxy)
+			{
+				TwoColumns::CollapsingGroup("Memory", [&]()
+				{
+					const FImGuiContextAllocator& Allocator = ContextProxy->GetAllocator();
+					TwoColumns::Value("Live KB", Allocator.GetLiveBytes() / 1024.f);
+					TwoColumns::Value("Peak KB", Allocator.GetPeakBytes() / 1024.f);
+					TwoColumns::Value("Reserved KB", Allocator.GetReservedBytes() / 1024.f);
+					TwoColumns::Value("Allocations Per Frame", Allocator.GetAllocationsPerFrame());
+					TwoColumns::Value("Large Allocations Per Frame", Allocator.GetLargeAllocationsPerFrame());
+				});
+			}
+
 			TwoColumns::CollapsingGroup("Input Mode", [&]()
 			{
 				TwoColumns::Value("Input Enabled", bInputEnabled);
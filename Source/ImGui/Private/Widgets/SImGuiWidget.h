@@ -26,6 +26,7 @@
 
 #include "ImGuiModuleDebug.h"
 #include "ImGuiModuleSettings.h"
+#include "TextureManager.h"
 
 #include <Rendering/RenderingCommon.h>
 #include <UObject/WeakObjectPtr.h>
@@ -36,7 +37,10 @@
 // Hide ImGui Widget debug in non-developer mode.
 #define IMGUI_WIDGET_DEBUG IMGUI_MODULE_DEVELOPER
 
+class FImGuiContextProxy;
 class FImGuiModuleManager;
+class FImGuiRenderTarget;
+class FImGuiSlateElement;
 class SImGuiCanvasControl;
 class UImGuiInputHandler;
 
@@ -114,6 +118,10 @@ private:
 
 	void SetHideMouseCursor(bool bHide);
 
+	void SetComposeInRenderTarget(bool bCompose);
+
+	void SetUseCustomSlateElement(bool bUse);
+
 	bool IsConsoleOpened() const;
 
 	// Update visibility based on input state.
@@ -142,6 +150,9 @@ private:
 
 	FVector2D TransformScreenPointToImGui(const FGeometry& MyGeometry, const FVector2D& Point) const;
 
+	// Convert draw data of the context to Slate geometry stored in cache.
+	void UpdateCachedDrawData(const FImGuiContextProxy& ContextProxy, const FSlateRenderTransform& ImGuiToScreen, const FSlateRect& MyClippingRect) const;
+
 	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& WidgetStyle, bool bParentEnabled) const override;
 
 	virtual FVector2D ComputeDesiredSize(float) const override;
@@ -159,8 +170,49 @@ private:
 	FSlateRenderTransform ImGuiTransform;
 	FSlateRenderTransform ImGuiRenderTransform;
 
-	mutable TArray<FSlateVertex> VertexBuffer;
-	mutable TArray<SlateIndex> IndexBuffer;
+	// Draw data converted to Slate geometry, one entry per draw batch (see FImGuiDrawBatches). It is kept between
+	// paints, so unchanged output (e.g. between updates of a context with a limited update rate) can be presented again
+	// without conversion. Array is not shrunk to keep allocations, so only the first NumCachedDrawBatches are valid.
+	struct FCachedDrawBatch
+	{
+		TArray<FSlateVertex> VertexBuffer;
+		TArray<SlateIndex> IndexBuffer;
+		FSlateRect ClippingRect;
+		TextureIndex TextureId;
+	};
+
+	mutable TArray<FCachedDrawBatch> CachedDrawBatches;
+	mutable int32 NumCachedDrawBatches = 0;
+
+	// Key of the cached draw data.
+	mutable const FImGuiContextProxy* CachedContextProxy = nullptr;
+	mutable uint32 CachedDrawDataVersion = 0;
+	mutable FSlateRenderTransform CachedImGuiToScreen;
+	mutable FSlateRect CachedClippingRect;
+
+	mutable int32 NumPaintsSinceConversion = 0;
+
+	// Statistics collected during the last paint.
+	struct FPaintStats
+	{
+		int32 NumDrawLists = 0;
+		int32 NumCulledDrawLists = 0;
+		int32 NumCommands = 0;
+		int32 NumCulledCommands = 0;
+		int32 NumVertices = 0;
+		int32 NumCulledVertices = 0;
+		int32 NumCulledIndices = 0;
+		int32 NumBatches = 0;
+	};
+
+	mutable FPaintStats PaintStats;
+
+	// Render target composing ImGui output, when enabled in settings. Presenting it replaces cached draw data.
+	TUniquePtr<FImGuiRenderTarget> RenderTarget;
+
+	// Custom Slate element drawing ImGui output, when enabled in settings. It shares the key with cached draw data.
+	mutable TSharedPtr<FImGuiSlateElement, ESPMode::ThreadSafe> SlateElement;
+	bool bUseCustomSlateElement = false;
 
 	int32 ContextIndex = 0;
 
@@ -0,0 +1,172 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <atomic>
+
+
+class FImGuiDeferredDrawQueue;
+struct FImGuiDeferredDrawCommand;
+
+/**
+ * Producer of ImGui primitives recorded on worker threads and drawn later on the game thread, in the ImGui context for
+ * which the producer was created (@see FImGuiModule::CreateDeferredDrawProducer).
+ *
+ * Commands are pushed to a lock-free queue owned by the context and drained during that context's debug frame, after
+ * world and multi-context debug delegates. Every producer has its own memory budget for commands waiting in the queue.
+ * Commands which would exceed that budget are dropped and counted, so stalled or busy game thread cannot cause
+ * unbounded growth.
+ *
+ * Producer functions can be called from any thread, but commands from one producer are only guaranteed to be drawn
+ * in the order in which they were pushed, if that producer is used by one thread at a time.
+ *
+ * Shapes are drawn in the background draw list using ImGui display coordinates only in the frame in which they are
+ * drained, so producers need to push them every frame. Text windows and plot windows are retained: they are drawn every
+ * frame until the producer replaces or clears their contents, so producers updating slower than the game thread, or
+ * out of phase with it, don't cause them to flicker. Text windows keep a fixed number of the most recent lines and
+ * each plotted series keeps a fixed number of the most recent samples.
+ */
+class IMGUI_API FImGuiDeferredDrawProducer : public TSharedFromThis<FImGuiDeferredDrawProducer, ESPMode::ThreadSafe>
+{
+public:
+
+	~FImGuiDeferredDrawProducer();
+
+	FImGuiDeferredDrawProducer(const FImGuiDeferredDrawProducer&) = delete;
+	FImGuiDeferredDrawProducer& operator=(const FImGuiDeferredDrawProducer&) = delete;
+
+	/** Get the name of this producer. */
+	const FString& GetName() const { return Name; }
+
+	/**
+	 * Add a line of text to a named window. Lines are kept until the window is replaced or cleared.
+	 *
+	 * @param Window - Name of the window to which the text should be added
+	 * @param Text - Text to add
+	 * @returns True, if command was queued or false, if it was dropped
+	 */
+	bool Text(const FName& Window, FString Text);
+
+	/**
+	 * Replace the whole contents of a named window. Unlike a sequence of Text calls, this is applied at once, so it
+	 * should be used by producers which periodically refresh the window.
+	 *
+	 * @param Window - Name of the window which contents should be replaced
+	 * @param Text - New contents, which can span multiple lines
+	 * @returns True, if command was queued or false, if it was dropped
+	 */
+	bool SetText(const FName& Window, FString Text);
+
+	/**
+	 * Clear a named window, so it is no longer drawn.
+	 *
+	 * @param Window - Name of the window to clear
+	 * @returns True, if command was queued or false, if it was dropped
+	 */
+	bool ClearText(const FName& Window);
+
+	/**
+	 * Draw a line in the background draw list.
+	 *
+	 * @param From - Start point in ImGui display coordinates
+	 * @param To - End point in ImGui display coordinates
+	 * @param Color - Line color
+	 * @param Thickness - Line thickness
+	 * @returns True, if command was queued or false, if it was dropped
+	 */
+	bool Line(const FVector2D& From, const FVector2D& To, const FColor& Color, float Thickness = 1.f);
+
+	/**
+	 * Draw a rectangle in the background draw list.
+	 *
+	 * @param Min - Upper-left corner in ImGui display coordinates
+	 * @param Max - Lower-right corner in ImGui display coordinates
+	 * @param Color - Rectangle color
+	 * @param Thickness - Outline thickness, ignored if rectangle is filled
+	 * @param bFilled - Whether to draw a filled rectangle rather than its outline
+	 * @returns True, if command was queued or false, if it was dropped
+	 */
+	bool Rect(const FVector2D& Min, const FVector2D& Max, const FColor& Color, float Thickness = 1.f, bool bFilled = false);
+
+	/**
+	 * Draw a circle in the background draw list.
+	 *
+	 * @param Center - Circle center in ImGui display coordinates
+	 * @param Radius - Circle radius
+	 * @param Color - Circle color
+	 * @param Thickness - Outline thickness, ignored if circle is filled
+	 * @param bFilled - Whether to draw a filled circle rather than its outline
+	 * @returns True, if command was queued or false, if it was dropped
+	 */
+	bool Circle(const FVector2D& Center, float Radius, const FColor& Color, float Thickness = 1.f, bool bFilled = false);
+
+	/**
+	 * Add a sample to a series plotted in a named plot window.
+	 *
+	 * @param Plot - Name of the plot window
+	 * @param Series - Name of the series in that plot
+	 * @param X - Sample X coordinate
+	 * @param Y - Sample Y coordinate
+	 * @returns True, if command was queued or false, if it was dropped
+	 */
+	bool PlotSample(const FName& Plot, const FName& Series, double X, double Y);
+
+	/** Get the number of bytes used by commands from this producer which are waiting in the queue. */
+	int32 GetPendingBytes() const { return PendingBytes.load(std::memory_order_relaxed); }
+
+	/** Get the maximal number of bytes that commands from this producer can use while waiting in the queue. */
+	int32 GetMaxPendingBytes() const { return MaxPendingBytes; }
+
+	/** Get the number of commands queued by this producer. */
+	uint64 GetNumQueued() const { return NumQueued.load(std::memory_order_relaxed); }
+
+	/** Get the number of commands dropped because the budget was exceeded or the context was destroyed. */
+	uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+private:
+
+	FImGuiDeferredDrawProducer(const FString& InName, int32 InMaxPendingBytes,
+		const TSharedRef<FImGuiDeferredDrawQueue, ESPMode::ThreadSafe>& InQueue);
+
+	bool Push(FImGuiDeferredDrawCommand&& Command);
+
+	// Return budget of a command that was drained from the queue.
+	void Release(int32 Size) { PendingBytes.fetch_sub(Size, std::memory_order_relaxed); }
+
+	TWeakPtr<FImGuiDeferredDrawQueue, ESPMode::ThreadSafe> Queue;
+
+	FString Name;
+	int32 MaxPendingBytes;
+
+	std::atomic<int32> PendingBytes{ 0 };
+	std::atomic<uint64> NumQueued{ 0 };
+	std::atomic<uint64> NumDropped{ 0 };
+
+	friend class FImGuiDeferredDrawQueue;
+	friend class FImGuiModule;
+};
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include "ImGuiDeferredDraw.h"
 #include "ImGuiDelegates.h"
 #include "ImGuiModuleProperties.h"
 #include "ImGuiTextureHandle.h"
@@ -142,6 +143,19 @@ public:
 
 	virtual void RebuildFontAtlas();
 
+	/**
+	 * Create a producer of deferred draw commands, which can be used on worker threads to draw in a specific world's
+	 * ImGui context, creating that context on demand. Producer itself needs to be created on the game thread.
+	 *
+	 * @param World - A specific world to draw in or null to use the current world
+	 * @param Name - Name of the producer
+	 * @param MaxPendingBytes - Memory budget for commands from this producer that wait to be drawn, commands which
+	 *     would exceed it are dropped
+	 * @returns Producer bound to the world's context (@see FImGuiDeferredDrawProducer)
+	 */
+	virtual TSharedRef<FImGuiDeferredDrawProducer, ESPMode::ThreadSafe> CreateDeferredDrawProducer(const UWorld* World,
+		const FString& Name, int32 MaxPendingBytes = 256 * 1024);
+
 	/**
 	 * Get ImGui module properties.
 	 *
@@ -202,8 +216,10 @@ private:
 #if WITH_EDITOR
 	virtual void SetProperties(const FImGuiModuleProperties& Properties);
 	struct FImGuiContextHandle* ImGuiContextHandle = nullptr;
+	struct FImPlotContextHandle* ImPlotContextHandle = nullptr;
 	struct FImGuiDelegatesContainerHandle* DelegatesContainerHandle = nullptr;
 	friend struct FImGuiContextHandle;
+	friend struct FImPlotContextHandle;
 	friend struct FImGuiDelegatesContainerHandle;
 #endif
 };
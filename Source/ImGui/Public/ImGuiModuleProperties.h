@@ -94,6 +94,15 @@ public:
 	/** Toggle ImGui demo. */
 	void ToggleDemo() { SetShowDemo(!ShowDemo()); }
 
+	/** Check whether ImGui log window is visible. */
+	bool ShowLog() const { return bShowLog; }
+
+	/** Show or hide ImGui log window. */
+	void SetShowLog(bool bShow) { bShowLog = bShow; }
+
+	/** Toggle ImGui log window. */
+	void ToggleLog() { SetShowLog(!ShowLog()); }
+
 	/** Adds a new font to initialize */
 	void AddCustomFont(FName FontName, TSharedPtr<ImFontConfig> Font) { CustomFonts.Emplace(FontName, Font); }
 
@@ -115,6 +124,7 @@ private:
 	bool bMouseInputShared = false;
 
 	bool bShowDemo = false;
+	bool bShowLog = false;
 
 	TMap<FName, TSharedPtr<ImFontConfig>> CustomFonts;
 };
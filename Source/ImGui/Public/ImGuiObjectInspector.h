@@ -0,0 +1,152 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <UObject/ObjectKey.h>
+
+#include <imgui.h>
+
+
+class FProperty;
+
+/**
+ * Reflection-driven inspector drawing properties of objects and structs as a read-only tree in the current ImGui
+ * window.
+ *
+ * Property layout of each class and struct is collected once and cached. Only expanded nodes are evaluated and
+ * elements of arrays, sets and maps are drawn through ImGuiListClipper, so the cost of inspecting large containers
+ * depends only on the number of visible rows. Containers assume rows of uniform height, so expanding elements of
+ * a large container makes its scroll range approximate.
+ *
+ * Values are converted to text at a configurable rate and cached between updates. Cached values which are not drawn
+ * for a while are released.
+ *
+ * Inspector is not thread-safe and it needs to be used on the game thread.
+ */
+class IMGUI_API FImGuiObjectInspector
+{
+public:
+
+	/**
+	 * Create an inspector.
+	 *
+	 * @param InRefreshRate - Number of value updates per second or zero to update values in every frame
+	 */
+	explicit FImGuiObjectInspector(float InRefreshRate = 10.f);
+
+	/** Get the number of value updates per second. Zero means that values are updated in every frame. */
+	float GetRefreshRate() const { return RefreshRate; }
+
+	/**
+	 * Set the number of value updates per second.
+	 *
+	 * @param Rate - Number of updates per second or zero to update values in every frame
+	 */
+	void SetRefreshRate(float Rate) { RefreshRate = FMath::Max(Rate, 0.f); }
+
+	/**
+	 * Draw properties of an object.
+	 *
+	 * @param Object - Object to inspect, if null nothing is drawn
+	 */
+	void Draw(UObject* Object);
+
+	/**
+	 * Draw properties of a struct.
+	 *
+	 * @param Struct - Type of the struct
+	 * @param Data - Pointer to the struct data
+	 * @param Label - Label of the root node
+	 */
+	void Draw(const UStruct* Struct, const void* Data, const char* Label);
+
+	/** Release cached layouts and values. */
+	void Reset();
+
+private:
+
+	enum class EPropertyKind : uint8
+	{
+		Value,
+		Struct,
+		Object,
+		Array,
+		Set,
+		Map
+	};
+
+	struct FPropertyLayout
+	{
+		const FProperty* Property;
+		TArray<ANSICHAR> Name;
+		EPropertyKind Kind;
+	};
+
+	struct FStructLayout
+	{
+		TArray<FPropertyLayout> Properties;
+
+		// Head of the property chain from which this layout was collected.
+		const FProperty* PropertyLink = nullptr;
+	};
+
+	struct FCachedValue
+	{
+		TArray<ANSICHAR> Text;
+
+		// Indices of valid elements in sparse containers.
+		TArray<int32> ElementIndices;
+
+		double UpdateTime = 0.0;
+		int32 LastUsedFrame = 0;
+	};
+
+	static EPropertyKind GetKind(const FProperty* Property);
+
+	const FStructLayout& GetLayout(const UStruct* Struct);
+	FCachedValue& GetCachedValue(ImGuiID Id, bool& bOutNeedsUpdate);
+	const char* GetValueText(ImGuiID Id, const FProperty* Property, const void* ValuePtr);
+	const TArray<int32>& GetElementIndices(ImGuiID Id, int32 NumElements, int32 MaxIndex, TFunctionRef<bool(int32)> IsValidIndex);
+	void PruneValues();
+
+	void DrawStruct(const UStruct* Struct, const void* Data);
+	void DrawProperty(const FProperty* Property, EPropertyKind Kind, const char* Label, const void* ValuePtr);
+	void DrawValue(const FProperty* Property, const char* Label, const void* ValuePtr);
+	void DrawObject(const FProperty* Property, const char* Label, const void* ValuePtr);
+	void DrawArray(const FProperty* Property, const char* Label, const void* ValuePtr);
+	void DrawSet(const FProperty* Property, const char* Label, const void* ValuePtr);
+	void DrawMap(const FProperty* Property, const char* Label, const void* ValuePtr);
+
+	// Layouts are referenced while drawing nested structs, so they need stable addresses.
+	TMap<TObjectKey<UStruct>, TUniquePtr<FStructLayout>> Layouts;
+	TMap<ImGuiID, FCachedValue> Values;
+
+	float RefreshRate = 10.f;
+	double CurrentTime = 0.0;
+	int32 CurrentFrame = 0;
+	int32 LastPruneFrame = 0;
+};
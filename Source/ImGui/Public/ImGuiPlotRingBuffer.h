@@ -0,0 +1,208 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <implot.h>
+
+#include <atomic>
+
+
+/**
+ * Fixed-size ring buffer for streaming samples from a single producer thread (e.g. gameplay or physics thread) into
+ * ImPlot plots drawn on the game thread.
+ *
+ * Storage is allocated once, at construction, so pushing and plotting never allocate. Plotting reads samples directly
+ * from the storage through ImPlot getters, so there is no copying and no splitting of series at the wrap-around point.
+ *
+ * Producer and plots are synchronised only with the atomic write index. To avoid plotting samples that are being
+ * overwritten, capacity includes a slack which is never visible to plots. Producer can safely push up to Slack samples
+ * while a series is being plotted.
+ *
+ * Samples can be arithmetic values, plotted against their sample index, or FVector2D/ImPlotPoint pairs with their own
+ * X coordinates. Other types can be supported by overloading ImGuiPlotRingBuffer::ToPlotPoint.
+ *
+ * @param T - Type of samples
+ * @param AllocatorType - Allocator used by the storage array (e.g. TFixedAllocator to embed storage in the buffer, in
+ *     which case it needs to fit visible samples and slack rounded up to a power of two)
+ */
+template<typename T, typename AllocatorType = FDefaultAllocator>
+class TImGuiPlotRingBuffer
+{
+public:
+
+	/**
+	 * Create a ring buffer.
+	 *
+	 * @param InMaxVisible - Maximal number of the most recent samples visible to plots
+	 * @param InSlack - Number of samples that producer can push while a series is plotted (defaults to a quarter of
+	 *     InMaxVisible)
+	 */
+	explicit TImGuiPlotRingBuffer(int32 InMaxVisible, int32 InSlack = INDEX_NONE)
+	{
+		checkf(InMaxVisible > 0, TEXT("Ring buffer needs to have at least one visible sample."));
+
+		const int32 Slack = (InSlack >= 0) ? InSlack : FMath::Max(InMaxVisible / 4, 1);
+		const uint32 Capacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(InMaxVisible + Slack));
+
+		Samples.SetNumZeroed(static_cast<int32>(Capacity));
+		Mask = Capacity - 1;
+		MaxVisible = InMaxVisible;
+	}
+
+	TImGuiPlotRingBuffer(const TImGuiPlotRingBuffer&) = delete;
+	TImGuiPlotRingBuffer& operator=(const TImGuiPlotRingBuffer&) = delete;
+
+	/** Push a sample to the buffer. Can be only called from the producer thread. */
+	void Push(const T& Sample)
+	{
+		const uint64 Index = WriteIndex.load(std::memory_order_relaxed);
+		Samples.GetData()[Index & Mask] = Sample;
+		WriteIndex.store(Index + 1, std::memory_order_release);
+	}
+
+	/**
+	 * Push a range of samples to the buffer. Can be only called from the producer thread. Samples are published
+	 * together, after the whole range is written.
+	 */
+	void Push(const T* InSamples, int32 Count)
+	{
+		const uint64 Index = WriteIndex.load(std::memory_order_relaxed);
+		T* Data = Samples.GetData();
+		for (int32 i = 0; i < Count; i++)
+		{
+			Data[(Index + i) & Mask] = InSamples[i];
+		}
+		WriteIndex.store(Index + Count, std::memory_order_release);
+	}
+
+	/** Remove all samples. Not thread-safe, producer must not push at the same time. */
+	void Reset()
+	{
+		WriteIndex.store(0, std::memory_order_release);
+	}
+
+	/** Get the number of samples visible to plots. */
+	int32 Num() const
+	{
+		return static_cast<int32>(FMath::Min<uint64>(WriteIndex.load(std::memory_order_acquire), MaxVisible));
+	}
+
+	/** Get the maximal number of samples visible to plots. */
+	int32 GetMaxVisible() const { return MaxVisible; }
+
+	/** Get the number of samples allocated in storage (including slack). */
+	int32 GetCapacity() const { return Samples.Num(); }
+
+	/** Get the number of samples pushed since construction or the last reset. */
+	uint64 GetNumPushed() const { return WriteIndex.load(std::memory_order_acquire); }
+
+	/**
+	 * Plot visible samples as a line.
+	 *
+	 * @param Label - ImPlot label of the series
+	 * @param XScale - Scale applied to sample index to get X of arithmetic samples
+	 * @param X0 - Offset added to scaled sample index to get X of arithmetic samples
+	 * @param Flags - ImPlot line flags
+	 */
+	void PlotLine(const char* Label, double XScale = 1.0, double X0 = 0.0, ImPlotLineFlags Flags = 0) const
+	{
+		FPlotView View = GetPlotView(XScale, X0);
+		ImPlot::PlotLineG(Label, &GetPlotPoint, &View, View.Num, Flags);
+	}
+
+	/**
+	 * Plot visible samples as a scatter.
+	 *
+	 * @param Label - ImPlot label of the series
+	 * @param XScale - Scale applied to sample index to get X of arithmetic samples
+	 * @param X0 - Offset added to scaled sample index to get X of arithmetic samples
+	 * @param Flags - ImPlot scatter flags
+	 */
+	void PlotScatter(const char* Label, double XScale = 1.0, double X0 = 0.0, ImPlotScatterFlags Flags = 0) const
+	{
+		FPlotView View = GetPlotView(XScale, X0);
+		ImPlot::PlotScatterG(Label, &GetPlotPoint, &View, View.Num, Flags);
+	}
+
+private:
+
+	// Snapshot of visible samples passed as user data to ImPlot getters. It only lives for the duration of a plot call.
+	struct FPlotView
+	{
+		const T* Data;
+		uint64 First;
+		uint64 Mask;
+		double XScale;
+		double X0;
+		int32 Num;
+	};
+
+	FPlotView GetPlotView(double XScale, double X0) const
+	{
+		const uint64 Last = WriteIndex.load(std::memory_order_acquire);
+		const uint64 NumVisible = FMath::Min<uint64>(Last, MaxVisible);
+		return { Samples.GetData(), Last - NumVisible, Mask, XScale, X0, static_cast<int32>(NumVisible) };
+	}
+
+	static ImPlotPoint GetPlotPoint(int Index, void* UserData);
+
+	TArray<T, AllocatorType> Samples;
+	std::atomic<uint64> WriteIndex{ 0 };
+	uint64 Mask = 0;
+	int32 MaxVisible = 0;
+};
+
+namespace ImGuiPlotRingBuffer
+{
+	/** Convert an arithmetic sample to a plot point, using X computed from the sample index. */
+	template<typename T, typename = typename TEnableIf<TIsArithmetic<T>::Value>::Type>
+	FORCEINLINE ImPlotPoint ToPlotPoint(const T& Sample, double X)
+	{
+		return ImPlotPoint(X, static_cast<double>(Sample));
+	}
+
+	/** Convert a sample with its own X coordinate to a plot point. */
+	FORCEINLINE ImPlotPoint ToPlotPoint(const FVector2D& Sample, double)
+	{
+		return ImPlotPoint(Sample.X, Sample.Y);
+	}
+
+	/** Convert a sample with its own X coordinate to a plot point. */
+	FORCEINLINE ImPlotPoint ToPlotPoint(const ImPlotPoint& Sample, double)
+	{
+		return Sample;
+	}
+}
+
+template<typename T, typename AllocatorType>
+ImPlotPoint TImGuiPlotRingBuffer<T, AllocatorType>::GetPlotPoint(int Index, void* UserData)
+{
+	const FPlotView& View = *static_cast<const FPlotView*>(UserData);
+	const uint64 SampleIndex = View.First + Index;
+	return ImGuiPlotRingBuffer::ToPlotPoint(View.Data[SampleIndex & View.Mask], View.X0 + View.XScale * SampleIndex);
+}
@@ -0,0 +1,170 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+
+/**
+ * Batch of world-space debug primitives drawn directly in an ImGui draw list. It is a faster alternative to projecting
+ * points one at a time in ImGui delegates or to DrawDebugLine, when drawing tens of thousands of primitives per frame.
+ *
+ * Positions of all primitives are projected together with SIMD math, relative to the view origin to keep precision
+ * with large world coordinates. Lines are clipped against the near plane and primitives outside of the view frustum
+ * are culled before being written to the draw list as untextured quads.
+ *
+ * Draw lists use 16-bit indices, so a single draw list can fit up to 16K lines and points per frame. Primitives that
+ * don't fit are skipped and not counted by Draw.
+ *
+ * Batch can be reused between frames (@see Reset). It is not thread-safe and it needs to be drawn on the game thread.
+ */
+class IMGUI_API FImGuiWorldPrimitives
+{
+public:
+
+	/** Remove all primitives, keeping allocated memory for the next frame. */
+	void Reset();
+
+	/**
+	 * Add a line.
+	 *
+	 * @param Start - Start point in world space
+	 * @param End - End point in world space
+	 * @param Color - Line color
+	 * @param Thickness - Line thickness in ImGui display units
+	 */
+	void AddLine(const FVector& Start, const FVector& End, const FColor& Color, float Thickness = 1.f);
+
+	/**
+	 * Add lines from an array of points, where every two consecutive points define one line.
+	 *
+	 * @param Points - Pairs of start and end points in world space
+	 * @param Color - Color of all lines
+	 * @param Thickness - Thickness of all lines in ImGui display units
+	 */
+	void AddLines(TArrayView<const FVector> Points, const FColor& Color, float Thickness = 1.f);
+
+	/**
+	 * Add a point drawn as a square.
+	 *
+	 * @param Position - Point in world space
+	 * @param Color - Point color
+	 * @param Size - Size of the square in ImGui display units
+	 */
+	void AddPoint(const FVector& Position, const FColor& Color, float Size = 4.f);
+
+	/**
+	 * Add points from an array.
+	 *
+	 * @param Positions - Points in world space
+	 * @param Color - Color of all points
+	 * @param Size - Size of all points in ImGui display units
+	 */
+	void AddPoints(TArrayView<const FVector> Positions, const FColor& Color, float Size = 4.f);
+
+	/**
+	 * Add an axis-aligned box drawn with its twelve edges.
+	 *
+	 * @param Box - Box in world space
+	 * @param Color - Color of the edges
+	 * @param Thickness - Thickness of the edges in ImGui display units
+	 */
+	void AddBox(const FBox& Box, const FColor& Color, float Thickness = 1.f);
+
+	/**
+	 * Add a text label.
+	 *
+	 * @param Position - Position of the upper-left corner of the label in world space
+	 * @param Text - Label text
+	 * @param Color - Text color
+	 */
+	void AddLabel(const FVector& Position, const FString& Text, const FColor& Color);
+
+	/**
+	 * Project all primitives and draw them in a draw list.
+	 *
+	 * @param DrawList - Draw list of the current ImGui context in which primitives should be drawn
+	 * @param ViewProjection - View-projection matrix used to project world positions
+	 * @param ViewOrigin - Origin of the view, used to project positions with single precision
+	 * @param DisplaySize - Size of the area to which clip space is mapped, in ImGui display units
+	 * @returns Number of primitives drawn
+	 */
+	int32 Draw(ImDrawList* DrawList, const FMatrix& ViewProjection, const FVector& ViewOrigin, const FVector2D& DisplaySize) const;
+
+	/**
+	 * Project all primitives using the view of the first local player in a world and draw them in the background draw
+	 * list of the current ImGui context, mapping the view to the whole ImGui display. Meant to be called from world
+	 * delegates of that world's context.
+	 *
+	 * @param World - World from which the view is taken
+	 * @returns Number of primitives drawn or zero, if the world doesn't have a local player with a viewport
+	 */
+	int32 Draw(const UWorld* World) const;
+
+private:
+
+	struct FEdge
+	{
+		int32 Start;
+		int32 End;
+		FColor Color;
+		float Thickness;
+	};
+
+	struct FPoint
+	{
+		int32 Position;
+		FColor Color;
+		float Size;
+	};
+
+	struct FLabel
+	{
+		int32 Position;
+		FColor Color;
+		FString Text;
+	};
+
+	// Screen-space quad ready to be written to a draw list.
+	struct FQuad
+	{
+		ImVec2 Corners[4];
+		ImU32 Color;
+	};
+
+	void ProjectPositions(const FMatrix& ViewProjection, const FVector& ViewOrigin) const;
+
+	TArray<FVector> Positions;
+	TArray<FEdge> Edges;
+	TArray<FPoint> Points;
+	TArray<FLabel> Labels;
+
+	// Scratch buffers reused between draws.
+	mutable TArray<FVector4f> ClipPositions;
+	mutable TArray<FQuad> Quads;
+};
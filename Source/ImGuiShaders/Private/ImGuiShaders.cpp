@@ -0,0 +1,51 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "ImGuiShaders.h"
+
+#include <Interfaces/IPluginManager.h>
+#include <Misc/Paths.h>
+#include <Modules/ModuleManager.h>
+#include <ShaderCore.h>
+
+
+IMPLEMENT_GLOBAL_SHADER(FImGuiVS, "/Plugin/ImGui/Private/ImGui.usf", "MainVS", SF_Vertex);
+IMPLEMENT_GLOBAL_SHADER(FImGuiPS, "/Plugin/ImGui/Private/ImGui.usf", "MainPS", SF_Pixel);
+
+// Module registering the shader directory of this plugin.
+class FImGuiShadersModule : public IModuleInterface
+{
+public:
+
+	virtual void StartupModule() override
+	{
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("ImGui"));
+		checkf(Plugin.IsValid(), TEXT("Failed to find ImGui plugin."));
+
+		AddShaderSourceDirectoryMapping(TEXT("/Plugin/ImGui"), FPaths::Combine(Plugin->GetBaseDir(), TEXT("Shaders")));
+	}
+};
+
+IMPLEMENT_MODULE(FImGuiShadersModule, ImGuiShaders)
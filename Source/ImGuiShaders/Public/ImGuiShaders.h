@@ -0,0 +1,64 @@
+// Copyright (c) 2017-2021 Sebastian Gross. All Rights Reserved.
+// Published by LeoGame in 2025.
+// This project is distributed under the MIT License (MIT).
+
+// MIT License
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <GlobalShader.h>
+#include <ShaderParameterStruct.h>
+
+
+// Vertex shader drawing ImGui vertices (ImDrawVert layout) directly. Positions are transformed from ImGui to screen
+// space on GPU, using the same row-vector convention as FSlateRenderTransform.
+class FImGuiVS : public FGlobalShader
+{
+public:
+
+	DECLARE_EXPORTED_GLOBAL_SHADER(FImGuiVS, IMGUISHADERS_API);
+	SHADER_USE_PARAMETER_STRUCT(FImGuiVS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, IMGUISHADERS_API)
+		SHADER_PARAMETER(FVector4f, TransformMatrix)       // 2x2 matrix of the ImGui to screen transform (M00, M01, M10, M11)
+		SHADER_PARAMETER(FVector2f, TransformTranslation)  // Translation of the ImGui to screen transform
+		SHADER_PARAMETER(FVector2f, InvViewportSize)       // Reciprocal of the viewport size, to convert screen to clip space
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters) { return true; }
+};
+
+// Pixel shader multiplying texture by vertex color, like Slate does for custom vertices.
+class FImGuiPS : public FGlobalShader
+{
+public:
+
+	DECLARE_EXPORTED_GLOBAL_SHADER(FImGuiPS, IMGUISHADERS_API);
+	SHADER_USE_PARAMETER_STRUCT(FImGuiPS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, IMGUISHADERS_API)
+		SHADER_PARAMETER_TEXTURE(Texture2D, Texture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, TextureSampler)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters) { return true; }
+};
@@ -2614,6 +2614,8 @@ struct ImGuiStoragePair
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// Storages with many keys inserted often (e.g. open state of a tree with 100k+ nodes) can enable a hash index with SetHashIndex(true),
+// see IMGUI_USE_HASHED_WINDOW_STORAGE in imconfig.h to enable it for the state storage of all windows.
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2621,12 +2623,16 @@ struct ImGuiStoragePair
 struct ImGuiStorage
 {
     // [Internal]
-    ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStoragePair>      Data;       // Sorted by key, or in insertion order when the hash index is enabled
+    ImVector<int>                   HashIndex;  // Open-addressing hash table of (index in Data + 1), 0 for empty slots. Empty when disabled.
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    // - With the hash index, a query is a probe into the hash table and insertion appends to Data. Data must not be modified directly then.
+    IMGUI_API void      Clear();
+    IMGUI_API void      SetHashIndex(bool enabled);
+    bool                HasHashIndex() const { return HashIndex.Size > 0; }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2696,18 +2696,106 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+// Hash index: open addressing with linear probing, kept at most half full.
+#define IMGUI_STORAGE_HASH_INDEX_MIN_SIZE   16
+
+static inline ImGuiID StorageHashKey(ImGuiID key)
+{
+    // Keys are usually hashes already, but user keys may be small sequential integers
+    key ^= key >> 16;
+    key *= 0x85EBCA6Bu;
+    key ^= key >> 13;
+    return key;
+}
+
+// Find the hash index slot holding a key, or the empty slot where it would be stored.
+static int* StorageFindHashSlot(const ImGuiStorage* storage, ImGuiID key)
+{
+    int* slots = const_cast<int*>(storage->HashIndex.Data);
+    const int mask = storage->HashIndex.Size - 1;
+    for (int slot_n = (int)(StorageHashKey(key) & mask); ; slot_n = (slot_n + 1) & mask)
+        if (slots[slot_n] == 0 || storage->Data.Data[slots[slot_n] - 1].key == key)
+            return &slots[slot_n];
+}
+
+static void StorageRebuildHashIndex(ImGuiStorage* storage)
+{
+    int slots_count = IMGUI_STORAGE_HASH_INDEX_MIN_SIZE;
+    while (slots_count < storage->Data.Size * 2)
+        slots_count *= 2;
+    storage->HashIndex.resize(slots_count);
+    memset(storage->HashIndex.Data, 0, (size_t)storage->HashIndex.size_in_bytes());
+    for (int n = 0; n < storage->Data.Size; n++)
+        *StorageFindHashSlot(storage, storage->Data.Data[n].key) = n + 1;
+}
+
+static ImGuiStoragePair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStoragePair* data = const_cast<ImGuiStoragePair*>(storage->Data.Data);
+    if (storage->HashIndex.Size > 0)
+    {
+        const int slot = *StorageFindHashSlot(storage, key);
+        return slot ? &data[slot - 1] : NULL;
+    }
+    ImGuiStoragePair* it = ImLowerBound(data, data + storage->Data.Size, key);
+    return (it != data + storage->Data.Size && it->key == key) ? it : NULL;
+}
+
+// Find a pair or insert it if missing.
+static ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStoragePair& pair)
+{
+    if (storage->HashIndex.Size > 0)
+    {
+        int* slot = StorageFindHashSlot(storage, pair.key);
+        if (*slot != 0)
+            return &storage->Data.Data[*slot - 1];
+        storage->Data.push_back(pair);
+        *slot = storage->Data.Size;
+        if (storage->Data.Size * 2 > storage->HashIndex.Size)
+            StorageRebuildHashIndex(storage);
+        return &storage->Data.back();
+    }
+    ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + storage->Data.Size, pair.key);
+    if (it == storage->Data.Data + storage->Data.Size || it->key != pair.key)
+        it = storage->Data.insert(it, pair);
+    return it;
+}
+
+void ImGuiStorage::Clear()
+{
+    Data.clear();
+    if (HashIndex.Size > 0)
+        StorageRebuildHashIndex(this);
+}
+
+// Enabling the hash index makes insertion O(1) and keeps new pairs in insertion order. Disabling it sorts pairs again.
+void ImGuiStorage::SetHashIndex(bool enabled)
+{
+    if (enabled == HasHashIndex())
+        return;
+    if (enabled)
+    {
+        StorageRebuildHashIndex(this);
+    }
+    else
+    {
+        HashIndex.clear();
+        BuildSortByKey();
+    }
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    if (HashIndex.Size > 0)
+        StorageRebuildHashIndex(this);
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_i;
+    const ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2717,27 +2805,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_f;
+    const ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return NULL;
-    return it->val_p;
+    const ImGuiStoragePair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2747,28 +2828,18 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_i = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2778,20 +2849,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_f = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_p = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -4216,6 +4279,8 @@ void ImGui::Shutdown()
     g.TablesTempData.clear_destruct();
     g.DrawChannelsTempMergeBuffer.clear();
 
+    g.TextSizeCache.Clear();
+
     g.MultiSelectStorage.Clear();
     g.MultiSelectTempData.clear_destruct();
 
@@ -4301,6 +4366,9 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NUL
     DrawList->_OwnerName = Name;
     DrawList->_Data = &Ctx->DrawListSharedData;
     NavPreferredScoringPosRel[0] = NavPreferredScoringPosRel[1] = ImVec2(FLT_MAX, FLT_MAX);
+#ifdef IMGUI_USE_HASHED_WINDOW_STORAGE
+    StateStorage.SetHashIndex(true);
+#endif
 }
 
 ImGuiWindow::~ImGuiWindow()
@@ -5164,6 +5232,15 @@ void ImGui::NewFrame()
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
 
+    // Drop text sizes and glyph runs built with fonts that have been rebuilt since
+    if (g.TextSizeCache.FontAtlas != g.IO.Fonts || g.TextSizeCache.FontAtlasTexPixels != g.IO.Fonts->TexPixelsAlpha8)
+    {
+        g.TextSizeCache.Clear();
+        g.DrawListSharedData.GlyphRunCache.Clear();
+        g.TextSizeCache.FontAtlas = g.IO.Fonts;
+        g.TextSizeCache.FontAtlasTexPixels = g.IO.Fonts->TexPixelsAlpha8;
+    }
+
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (ImGuiViewportP* viewport : g.Viewports)
         viewport->DrawDataP.Valid = false;
@@ -5738,6 +5815,59 @@ void ImGui::Render()
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
+// Find the cached size of a text (*found = true), or replace the least recently used entry of its bucket with the text key, ready to store its size.
+// Returns NULL if the cache is disabled.
+static ImGuiTextSizeCacheEntry* FindTextSizeCacheEntry(ImGuiTextSizeCache& cache, ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end, int frame_count, bool* found)
+{
+#if IMGUI_TEXT_SIZE_CACHE_CAPACITY > 0
+    IM_STATIC_ASSERT((IMGUI_TEXT_SIZE_CACHE_CAPACITY & (IMGUI_TEXT_SIZE_CACHE_CAPACITY - 1)) == 0 && IMGUI_TEXT_SIZE_CACHE_CAPACITY >= IMGUI_TEXT_SIZE_CACHE_BUCKET_SIZE);
+    if (cache.Entries.Size == 0)
+    {
+        cache.Entries.resize(IMGUI_TEXT_SIZE_CACHE_CAPACITY);
+        memset(cache.Entries.Data, 0, (size_t)cache.Entries.size_in_bytes());
+    }
+
+    const int text_length = (int)(text_end - text);
+    ImGuiID text_hash = ImHashStr(text, text_length);
+    if (text_hash == 0)
+        text_hash = 1; // 0 marks unused entries
+    ImGuiID key = ImHashData(&font, sizeof(font), text_hash);
+    key = ImHashData(&font_size, sizeof(font_size), key);
+    key = ImHashData(&wrap_width, sizeof(wrap_width), key);
+
+    ImGuiTextSizeCacheEntry* bucket = &cache.Entries.Data[key & (IMGUI_TEXT_SIZE_CACHE_CAPACITY - IMGUI_TEXT_SIZE_CACHE_BUCKET_SIZE)];
+    ImGuiTextSizeCacheEntry* oldest = bucket;
+    for (int n = 0; n < IMGUI_TEXT_SIZE_CACHE_BUCKET_SIZE; n++)
+    {
+        ImGuiTextSizeCacheEntry* entry = &bucket[n];
+        if (entry->TextHash == text_hash && entry->TextLength == text_length && entry->Font == font && entry->FontSize == font_size && entry->WrapWidth == wrap_width)
+        {
+            entry->LastUsedFrame = frame_count;
+            cache.Hits++;
+            *found = true;
+            return entry;
+        }
+        if (entry->TextHash == 0 || (oldest->TextHash != 0 && entry->LastUsedFrame < oldest->LastUsedFrame))
+            oldest = entry;
+    }
+
+    // Caller stores the size after measuring it
+    cache.Misses++;
+    *found = false;
+    oldest->TextHash = text_hash;
+    oldest->TextLength = text_length;
+    oldest->Font = font;
+    oldest->FontSize = font_size;
+    oldest->WrapWidth = wrap_width;
+    oldest->LastUsedFrame = frame_count;
+    return oldest;
+#else
+    IM_UNUSED(cache); IM_UNUSED(font); IM_UNUSED(font_size); IM_UNUSED(wrap_width); IM_UNUSED(text); IM_UNUSED(text_end); IM_UNUSED(frame_count);
+    *found = false;
+    return NULL;
+#endif
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -5754,6 +5884,15 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+    if (text_display_end == NULL)
+        text_display_end = text + strlen(text);
+
+    // Reuse size of the same text measured with the same font, size and wrap width
+    bool found;
+    ImGuiTextSizeCacheEntry* entry = FindTextSizeCacheEntry(g.TextSizeCache, font, font_size, wrap_width, text, text_display_end, g.FrameCount, &found);
+    if (found)
+        return entry->Size;
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
@@ -5763,6 +5902,8 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
     text_size.x = IM_TRUNC(text_size.x + 0.99999f);
 
+    if (entry != NULL)
+        entry->Size = text_size;
     return text_size;
 }
 
@@ -15818,6 +15959,11 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         Text("NavWindowingTarget: '%s'", g.NavWindowingTarget ? g.NavWindowingTarget->Name : "NULL");
         Unindent();
 
+        Text("TEXT SIZE CACHE");
+        Indent();
+        Text("Entries: %d, Hits: %" IM_PRIu64 ", Misses: %" IM_PRIu64, g.TextSizeCache.Entries.Size, g.TextSizeCache.Hits, g.TextSizeCache.Misses);
+        Unindent();
+
         TreePop();
     }
 
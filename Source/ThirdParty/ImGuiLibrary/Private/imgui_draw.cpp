@@ -779,6 +779,101 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+#ifdef IMGUI_ENABLE_SSE
+// SSE versions of the AddPolyline() anti-aliased loops, processing two points per iteration.
+// - They perform the same operations in the same order as the scalar macros above (_mm_rsqrt_ps() matches ImRsqrt()), so output matches the scalar path within float rounding
+//   (the compiler may still contract or reassociate the scalar expressions differently, e.g. into FMA).
+// - They only process segments which don't wrap around (i2 == i1 + 1) in pairs, and return the number of segments done. Scalar loops do the rest.
+// - Lane layout of a register is { x0, y0, x1, y1 } for two consecutive ImVec2.
+
+// Sum of squares of each ImVec2 in both of its lanes: { x0*x0 + y0*y0, x0*x0 + y0*y0, x1*x1 + y1*y1, x1*x1 + y1*y1 }
+static inline __m128 ImPolylineLengthSqr2(__m128 v)
+{
+    const __m128 sq = _mm_mul_ps(v, v);
+    return _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+// Select 'a' where mask is set, 'b' elsewhere
+static inline __m128 ImPolylineSelect(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Normals of segments [0, count), see "Calculate normals" in AddPolyline(). Reads points [0, count].
+static int ImPolylineNormalsSSE(const ImVec2* points, int count, ImVec2* out_normals)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 negate_y = _mm_castsi128_ps(_mm_set_epi32((int)0x80000000, 0, (int)0x80000000, 0));
+    int i1 = 0;
+    for (; i1 + 2 <= count; i1 += 2)
+    {
+        __m128 d = _mm_sub_ps(_mm_loadu_ps(&points[i1 + 1].x), _mm_loadu_ps(&points[i1].x));
+        const __m128 d2 = ImPolylineLengthSqr2(d);
+        d = _mm_mul_ps(d, ImPolylineSelect(_mm_cmpgt_ps(d2, zero), _mm_rsqrt_ps(d2), one)); // IM_NORMALIZE2F_OVER_ZERO()
+        d = _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)), negate_y);                // { dy, -dx }
+        _mm_storeu_ps(&out_normals[i1].x, d);
+    }
+    return i1;
+}
+
+// Averaged and fixed normals at the end points of segments [0, count), see "Average normals" in AddPolyline(). Reads normals and points [0, count].
+static inline __m128 ImPolylineAverageNormals2(const ImVec2* normals, int i1)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 fix_min_d2 = _mm_set1_ps(0.000001f);
+    const __m128 fix_max_inv_len2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 dm = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&normals[i1].x), _mm_loadu_ps(&normals[i1 + 1].x)), half);
+    const __m128 d2 = ImPolylineLengthSqr2(dm);
+    const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), fix_max_inv_len2);
+    return _mm_mul_ps(dm, ImPolylineSelect(_mm_cmpgt_ps(d2, fix_min_d2), inv_len2, one)); // IM_FIXNORMAL2F()
+}
+
+// Outer edge points of [PATH 1] and [PATH 2] (non-thick): 2 temporary points per line point
+static int ImPolylineEdgesSSE(const ImVec2* points, const ImVec2* normals, int count, float half_draw_size, ImVec2* out_points)
+{
+    const __m128 half_draw_size_v = _mm_set1_ps(half_draw_size);
+    int i1 = 0;
+    for (; i1 + 2 <= count; i1 += 2)
+    {
+        const __m128 dm = _mm_mul_ps(ImPolylineAverageNormals2(normals, i1), half_draw_size_v);
+        const __m128 p = _mm_loadu_ps(&points[i1 + 1].x);
+        const __m128 a = _mm_add_ps(p, dm);
+        const __m128 b = _mm_sub_ps(p, dm);
+        float* out_vtx = &out_points[(i1 + 1) * 2].x;
+        _mm_storeu_ps(out_vtx + 0, _mm_movelh_ps(a, b));
+        _mm_storeu_ps(out_vtx + 4, _mm_movehl_ps(b, a));
+    }
+    return i1;
+}
+
+// Outer and inner edge points of [PATH 2] (thick): 4 temporary points per line point
+static int ImPolylineThickEdgesSSE(const ImVec2* points, const ImVec2* normals, int count, float half_inner_thickness, float aa_size, ImVec2* out_points)
+{
+    const __m128 out_scale = _mm_set1_ps(half_inner_thickness + aa_size);
+    const __m128 in_scale = _mm_set1_ps(half_inner_thickness);
+    int i1 = 0;
+    for (; i1 + 2 <= count; i1 += 2)
+    {
+        const __m128 dm = ImPolylineAverageNormals2(normals, i1);
+        const __m128 dm_out = _mm_mul_ps(dm, out_scale);
+        const __m128 dm_in = _mm_mul_ps(dm, in_scale);
+        const __m128 p = _mm_loadu_ps(&points[i1 + 1].x);
+        const __m128 a = _mm_add_ps(p, dm_out);
+        const __m128 b = _mm_add_ps(p, dm_in);
+        const __m128 c = _mm_sub_ps(p, dm_in);
+        const __m128 d = _mm_sub_ps(p, dm_out);
+        float* out_vtx = &out_points[(i1 + 1) * 4].x;
+        _mm_storeu_ps(out_vtx + 0, _mm_movelh_ps(a, b));
+        _mm_storeu_ps(out_vtx + 4, _mm_movelh_ps(c, d));
+        _mm_storeu_ps(out_vtx + 8, _mm_movehl_ps(b, a));
+        _mm_storeu_ps(out_vtx + 12, _mm_movehl_ps(d, c));
+    }
+    return i1;
+}
+#endif // #ifdef IMGUI_ENABLE_SSE
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -820,8 +915,18 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         ImVec2* temp_normals = _Data->TempBuffer.Data;
         ImVec2* temp_points = temp_normals + points_count;
 
+        // SSE versions of the loops process the segments that don't wrap around, then scalar loops do the rest (if any)
+        // (for closed lines this excludes the closing segment)
+#ifdef IMGUI_ENABLE_SSE
+        const int simd_count = _Data->DisableSIMD ? 0 : ImMin(count, points_count - 1);
+#endif
+
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
+        int i1_start = 0;
+#ifdef IMGUI_ENABLE_SSE
+        i1_start = ImPolylineNormalsSSE(points, simd_count, temp_normals);
+#endif
+        for (int i1 = i1_start; i1 < count; i1++)
         {
             const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
             float dx = points[i2].x - points[i1].x;
@@ -855,14 +960,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Generate the vertices for the line edges
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            i1_start = 0;
+#ifdef IMGUI_ENABLE_SSE
+            i1_start = ImPolylineEdgesSSE(points, temp_normals, simd_count, half_draw_size, temp_points);
+#endif
+            for (int i1 = i1_start; i1 < count; i1++) // i1 is the first point of the line segment
             {
                 const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
-                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
@@ -877,6 +984,13 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[0].y = points[i2].y + dm_y;
                 out_vtx[1].x = points[i2].x - dm_x;
                 out_vtx[1].y = points[i2].y - dm_y;
+            }
+
+            // Generate the indices to form a number of triangles for each line segment
+            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
+            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            {
+                const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
                 if (use_texture)
                 {
@@ -951,14 +1065,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Generate the vertices for the line edges
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
-            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
-            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            i1_start = 0;
+#ifdef IMGUI_ENABLE_SSE
+            i1_start = ImPolylineThickEdgesSSE(points, temp_normals, simd_count, half_inner_thickness, AA_SIZE, temp_points);
+#endif
+            for (int i1 = i1_start; i1 < count; i1++) // i1 is the first point of the line segment
             {
                 const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
-                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
@@ -979,6 +1095,13 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[2].y = points[i2].y - dm_in_y;
                 out_vtx[3].x = points[i2].x - dm_out_x;
                 out_vtx[3].y = points[i2].y - dm_out_y;
+            }
+
+            // Generate the indices to form a number of triangles for each line segment
+            unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
+            for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
+            {
+                const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
@@ -4104,6 +4227,114 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->PrimRectUV(ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale), ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
 }
 
+// Find the cached glyph run of a text. On a miss, returns NULL and outputs the least recently used run of its bucket,
+// which StoreGlyphRun() can replace once the text is known to be rendered without clipping. Outputs NULL if the cache is disabled.
+static ImDrawListGlyphRun* FindGlyphRun(ImDrawListGlyphRunCache& cache, ImFont* font, float size, ImU32 col, float wrap_width, const char* text_begin, const char* text_end, ImDrawListGlyphRun** out_slot)
+{
+    *out_slot = NULL;
+#if IM_DRAWLIST_GLYPH_RUN_CACHE_CAPACITY > 0
+    IM_STATIC_ASSERT((IM_DRAWLIST_GLYPH_RUN_CACHE_CAPACITY & (IM_DRAWLIST_GLYPH_RUN_CACHE_CAPACITY - 1)) == 0 && IM_DRAWLIST_GLYPH_RUN_CACHE_CAPACITY >= IM_DRAWLIST_GLYPH_RUN_BUCKET_SIZE);
+    if (cache.Entries.Size == 0)
+    {
+        cache.Entries.resize(IM_DRAWLIST_GLYPH_RUN_CACHE_CAPACITY);
+        memset(cache.Entries.Data, 0, (size_t)cache.Entries.size_in_bytes());
+    }
+
+    const int text_length = (int)(text_end - text_begin);
+    ImGuiID text_hash = ImHashStr(text_begin, text_length);
+    if (text_hash == 0)
+        text_hash = 1; // 0 marks unused entries
+    ImGuiID key = ImHashData(&font, sizeof(font), text_hash);
+    key = ImHashData(&size, sizeof(size), key);
+    key = ImHashData(&col, sizeof(col), key);
+    key = ImHashData(&wrap_width, sizeof(wrap_width), key);
+
+    const ImU32 use_count = ++cache.UseCount;
+    ImDrawListGlyphRun* bucket = &cache.Entries.Data[key & (IM_DRAWLIST_GLYPH_RUN_CACHE_CAPACITY - IM_DRAWLIST_GLYPH_RUN_BUCKET_SIZE)];
+    ImDrawListGlyphRun* oldest = bucket;
+    for (int n = 0; n < IM_DRAWLIST_GLYPH_RUN_BUCKET_SIZE; n++)
+    {
+        ImDrawListGlyphRun* run = &bucket[n];
+        if (run->TextHash == text_hash && run->TextLength == text_length && run->Font == font && run->Size == size && run->Col == col && run->WrapWidth == wrap_width
+            && memcmp(run->Text, text_begin, (size_t)text_length) == 0)
+        {
+            run->LastUsed = use_count;
+            return run;
+        }
+        // Use count wraps around, so compare ages rather than values
+        if (run->TextHash == 0 || (oldest->TextHash != 0 && use_count - run->LastUsed > use_count - oldest->LastUsed))
+            oldest = run;
+    }
+    *out_slot = oldest;
+#else
+    IM_UNUSED(cache); IM_UNUSED(font); IM_UNUSED(size); IM_UNUSED(col); IM_UNUSED(wrap_width); IM_UNUSED(text_begin); IM_UNUSED(text_end);
+#endif
+    return NULL;
+}
+
+// Replace a run returned by FindGlyphRun() with vertices of a text rendered at origin_x, origin_y.
+static void StoreGlyphRun(ImDrawListGlyphRunCache& cache, ImDrawListGlyphRun* run, ImFont* font, float size, ImU32 col, float wrap_width, const char* text_begin, const char* text_end, const ImDrawVert* vtx_begin, int vtx_count, float origin_x, float origin_y)
+{
+    const int text_length = (int)(text_end - text_begin);
+    IM_ASSERT(text_length <= IM_DRAWLIST_GLYPH_RUN_MAX_LENGTH);
+    run->TextHash = ImHashStr(text_begin, text_length);
+    if (run->TextHash == 0)
+        run->TextHash = 1; // 0 marks unused entries
+    run->TextLength = text_length;
+    memcpy(run->Text, text_begin, (size_t)text_length);
+    run->Font = font;
+    run->Size = size;
+    run->WrapWidth = wrap_width;
+    run->Col = col;
+    run->LastUsed = cache.UseCount;
+    run->Bounds = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+
+    // Store vertices relative to the text position
+    run->Vertices.resize(vtx_count);
+    if (vtx_count > 0)
+        run->Bounds = ImVec4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int n = 0; n < vtx_count; n++)
+    {
+        ImDrawVert& v = run->Vertices.Data[n];
+        v = vtx_begin[n];
+        v.pos.x -= origin_x;
+        v.pos.y -= origin_y;
+        run->Bounds.x = ImMin(run->Bounds.x, v.pos.x); run->Bounds.y = ImMin(run->Bounds.y, v.pos.y);
+        run->Bounds.z = ImMax(run->Bounds.z, v.pos.x); run->Bounds.w = ImMax(run->Bounds.w, v.pos.y);
+    }
+}
+
+// Emit a cached glyph run at a pixel aligned position.
+static void RenderGlyphRun(ImDrawList* draw_list, const ImDrawListGlyphRun& run, float x, float y)
+{
+    const int vtx_count = run.Vertices.Size;
+    if (vtx_count == 0)
+        return;
+    draw_list->PrimReserve(vtx_count / 4 * 6, vtx_count);
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+    const ImDrawVert* vtx_read = run.Vertices.Data;
+    for (int n = 0; n < vtx_count; n += 4)
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            vtx_write[k] = vtx_read[k];
+            vtx_write[k].pos.x += x;
+            vtx_write[k].pos.y += y;
+        }
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+        vtx_read += 4;
+        vtx_write += 4;
+        vtx_index += 4;
+        idx_write += 6;
+    }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip)
 {
@@ -4116,9 +4347,28 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     if (y > clip_rect.w)
         return;
 
+    // Re-emit vertices of the same text rendered before, if it is entirely visible.
+    // Otherwise render it as usual and, on a cache miss, store its vertices if no glyph got clipped.
+    ImDrawListGlyphRun* run_slot = NULL;
+    const char* run_text_begin = text_begin;
+    const char* run_text_end = text_end;
+    if (draw_list->_Data != NULL && text_end - text_begin <= IM_DRAWLIST_GLYPH_RUN_MAX_LENGTH)
+    {
+        if (ImDrawListGlyphRun* run = FindGlyphRun(draw_list->_Data->GlyphRunCache, this, size, col, wrap_width, text_begin, text_end, &run_slot))
+        {
+            if (x + run->Bounds.x >= clip_rect.x && y + run->Bounds.y >= clip_rect.y && x + run->Bounds.z <= clip_rect.z && y + run->Bounds.w <= clip_rect.w)
+            {
+                RenderGlyphRun(draw_list, *run, x, y);
+                return;
+            }
+        }
+    }
+    bool clipped = false;
+
     const float scale = size / FontSize;
     const float line_height = FontSize * scale;
     const float origin_x = x;
+    const float origin_y = y;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
 
     // Fast-forward to first visible line
@@ -4140,6 +4390,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                 s = line_end ? line_end + 1 : text_end;
             }
             y += line_height;
+            clipped = true;
         }
 
     // For large text, scan for the last visible line in order to avoid over-reserving in the call to PrimReserve()
@@ -4167,6 +4418,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+    ImDrawVert*  vtx_begin = vtx_write;
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
@@ -4184,7 +4436,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                 x = origin_x;
                 y += line_height;
                 if (y > clip_rect.w)
+                {
+                    clipped = true;
                     break; // break out of main loop
+                }
                 word_wrap_eol = NULL;
                 s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
                 continue;
@@ -4205,7 +4460,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                 x = origin_x;
                 y += line_height;
                 if (y > clip_rect.w)
+                {
+                    clipped = true;
                     break; // break out of main loop
+                }
                 continue;
             }
             if (c == '\r')
@@ -4233,8 +4491,9 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                 float v2 = glyph->V1;
 
                 // CPU side clipping used to fit text in their frame when the frame is too small. Only does clipping for axis aligned quads.
-                if (cpu_fine_clip)
+                if (cpu_fine_clip && (x1 < clip_rect.x || y1 < clip_rect.y || x2 > clip_rect.z || y2 > clip_rect.w))
                 {
+                    clipped = true;
                     if (x1 < clip_rect.x)
                     {
                         u1 = u1 + (1.0f - (x2 - clip_rect.x) / (x2 - x1)) * (u2 - u1);
@@ -4278,10 +4537,18 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                     idx_write += 6;
                 }
             }
+            else
+            {
+                clipped = true;
+            }
         }
         x += char_width;
     }
 
+    // Only runs rendered without clipping are stored, so a miss doesn't evict a live run when nothing gets stored.
+    if (run_slot != NULL && !clipped)
+        StoreGlyphRun(draw_list->_Data->GlyphRunCache, run_slot, this, size, col, wrap_width, run_text_begin, run_text_end, vtx_begin, (int)(vtx_write - vtx_begin), origin_x, origin_y);
+
     // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
     draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
     draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
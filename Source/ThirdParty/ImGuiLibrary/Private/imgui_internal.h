@@ -787,6 +787,43 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Glyph run cache used by ImFont::RenderText(), see ImDrawListGlyphRunCache.
+#ifndef IM_DRAWLIST_GLYPH_RUN_CACHE_CAPACITY
+#define IM_DRAWLIST_GLYPH_RUN_CACHE_CAPACITY                    1024 // Number of cached runs. Must be a power of two, 0 to disable.
+#endif
+#ifndef IM_DRAWLIST_GLYPH_RUN_MAX_LENGTH
+#define IM_DRAWLIST_GLYPH_RUN_MAX_LENGTH                        128  // Longer texts are not cached, which bounds memory used by each run.
+#endif
+#define IM_DRAWLIST_GLYPH_RUN_BUCKET_SIZE                       4    // Number of slots probed for a key, a miss replaces the least recently used one.
+
+// Vertices of a text rendered by ImFont::RenderText(), relative to its pixel aligned position
+struct ImDrawListGlyphRun
+{
+    ImGuiID                 TextHash;           // Hash of the text, 0 for an unused entry
+    int                     TextLength;
+    ImFont*                 Font;
+    float                   Size;
+    float                   WrapWidth;
+    ImU32                   Col;
+    ImU32                   LastUsed;           // Value of ImDrawListGlyphRunCache::UseCount when the run was last used
+    ImVec4                  Bounds;             // Bounding box of vertices (x1, y1, x2, y2)
+    ImVector<ImDrawVert>    Vertices;           // 4 vertices per glyph quad, indices are implicit
+    char                    Text[IM_DRAWLIST_GLYPH_RUN_MAX_LENGTH]; // Text bytes, compared on a hit to rule out hash collisions
+};
+
+// Cache of glyph runs keyed by font, size, color, wrap width and text. Text that is rendered without any clipping is stored
+// and re-emitted by copying and translating its vertices, as long as it stays entirely within the clip rectangle.
+// Memory is bounded by a fixed number of runs of at most IM_DRAWLIST_GLYPH_RUN_MAX_LENGTH characters.
+struct ImDrawListGlyphRunCache
+{
+    ImVector<ImDrawListGlyphRun> Entries;       // IM_DRAWLIST_GLYPH_RUN_CACHE_CAPACITY entries, allocated on first use
+    ImU32                   UseCount;
+
+    ImDrawListGlyphRunCache()   { UseCount = 0; }
+    ~ImDrawListGlyphRunCache()  { Clear(); }
+    void Clear()                { Entries.clear_destruct(); }
+};
+
 // Data shared between all ImDrawList instances
 // Conceptually this could have been called e.g. ImDrawListSharedContext
 // Typically one ImGui context would create and maintain one of this.
@@ -802,7 +839,9 @@ struct IMGUI_API ImDrawListSharedData
     float           CircleSegmentMaxError;      // Number of circle segments to use per pixel of radius for AddCircle() etc
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
+    bool            DisableSIMD;                // Use scalar code instead of SIMD versions of AddPolyline() loops (to compare them, output matches within float rounding)
     ImVector<ImVec2> TempBuffer;                // Temporary write buffer
+    ImDrawListGlyphRunCache GlyphRunCache;      // Text vertices reused across frames (cleared when the font atlas is rebuilt)
 
     // Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
@@ -821,6 +860,38 @@ struct ImDrawDataBuilder
     ImDrawDataBuilder()                     { memset(this, 0, sizeof(*this)); }
 };
 
+// Text size cache: number of sizes measured by CalcTextSize() kept per context. Must be a power of two, 0 to disable.
+#ifndef IMGUI_TEXT_SIZE_CACHE_CAPACITY
+#define IMGUI_TEXT_SIZE_CACHE_CAPACITY          4096
+#endif
+#define IMGUI_TEXT_SIZE_CACHE_BUCKET_SIZE       4       // Number of slots probed for a key, a miss replaces the least recently used one
+
+// Text size measured by CalcTextSize()
+struct ImGuiTextSizeCacheEntry
+{
+    ImGuiID         TextHash;                   // Hash of the measured text, 0 for an unused entry
+    int             TextLength;
+    ImFont*         Font;
+    float           FontSize;
+    float           WrapWidth;
+    int             LastUsedFrame;
+    ImVec2          Size;
+};
+
+// Cache of text sizes in front of ImFont::CalcTextSizeA(), keyed by font, font size, wrap width and text.
+// Memory is bounded by a fixed number of entries, ageing out the ones not used for the most frames.
+struct ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Entries;  // IMGUI_TEXT_SIZE_CACHE_CAPACITY entries, allocated on first use
+    ImFontAtlas*    FontAtlas;                  // Atlas and pixels that sizes were measured with, entries are cleared when the atlas is rebuilt
+    const void*     FontAtlasTexPixels;
+    ImU64           Hits;                       // Number of cached sizes returned (since context creation)
+    ImU64           Misses;                     // Number of sizes measured and stored (since context creation)
+
+    ImGuiTextSizeCache()                    { FontAtlas = NULL; FontAtlasTexPixels = NULL; Hits = Misses = 0; }
+    void            Clear()                 { Entries.clear(); }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Data types support
 //-----------------------------------------------------------------------------
@@ -2063,6 +2134,7 @@ struct ImGuiContext
     float                   FontScale;                          // == FontSize / Font->FontSize
     float                   CurrentDpiScale;                    // Current window/viewport DpiScale
     ImDrawListSharedData    DrawListSharedData;
+    ImGuiTextSizeCache      TextSizeCache;                      // Sizes measured by CalcTextSize(), reused across frames
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
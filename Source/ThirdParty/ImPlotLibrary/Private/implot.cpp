@@ -163,6 +163,11 @@ You can read releases logs https://github.com/epezent/implot/releases for more d
 ImPlotContext* GImPlot = nullptr;
 #endif
 
+// Texture functions shared by all contexts
+static ImPlotTextureUpdateFunc  GImPlotTextureUpdateFunc  = nullptr;
+static ImPlotTextureReleaseFunc GImPlotTextureReleaseFunc = nullptr;
+static void*                    GImPlotTextureUserData    = nullptr;
+
 //-----------------------------------------------------------------------------
 // Struct Implementations
 //-----------------------------------------------------------------------------
@@ -430,6 +435,18 @@ void SetImGuiContext(ImGuiContext* ctx) {
     ImGui::SetCurrentContext(ctx);
 }
 
+void SetTextureFunctions(ImPlotTextureUpdateFunc update_func, ImPlotTextureReleaseFunc release_func, void* user_data) {
+    GImPlotTextureUpdateFunc  = update_func;
+    GImPlotTextureReleaseFunc = release_func;
+    GImPlotTextureUserData    = user_data;
+}
+
+void GetTextureFunctions(ImPlotTextureUpdateFunc* p_update_func, ImPlotTextureReleaseFunc* p_release_func, void** p_user_data) {
+    *p_update_func  = GImPlotTextureUpdateFunc;
+    *p_release_func = GImPlotTextureReleaseFunc;
+    *p_user_data    = GImPlotTextureUserData;
+}
+
 ImPlotContext* CreateContext() {
     ImPlotContext* ctx = IM_NEW(ImPlotContext)();
     Initialize(ctx);
@@ -443,6 +460,12 @@ void DestroyContext(ImPlotContext* ctx) {
         ctx = GImPlot;
     if (GImPlot == ctx)
         SetCurrentContext(nullptr);
+    if (GImPlotTextureReleaseFunc != nullptr) {
+        for (int i = 0; i < ctx->HeatmapTextures.Size; ++i) {
+            if (ctx->HeatmapTextures[i].Texture != 0)
+                GImPlotTextureReleaseFunc(ctx->HeatmapTextures[i].Texture, GImPlotTextureUserData);
+        }
+    }
     IM_DELETE(ctx);
 }
 
@@ -451,7 +474,11 @@ ImPlotContext* GetCurrentContext() {
 }
 
 void SetCurrentContext(ImPlotContext* ctx) {
+#ifdef IMPLOT_SET_CURRENT_CONTEXT_FUNC
+    IMPLOT_SET_CURRENT_CONTEXT_FUNC(ctx);
+#else
     GImPlot = ctx;
+#endif
 }
 
 #define IMPLOT_APPEND_CMAP(name, qual) ctx->ColormapData.Append(#name, name, sizeof(name)/sizeof(ImU32), qual)
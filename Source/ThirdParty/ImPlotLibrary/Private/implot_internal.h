@@ -69,6 +69,12 @@
 #define IMPLOT_NUM_X_AXES ImAxis_Y1
 #define IMPLOT_NUM_Y_AXES (ImAxis_COUNT - IMPLOT_NUM_X_AXES)
 
+// Runs func(job) for every job in [0 count), possibly in parallel. Jobs must not call ImGui or ImPlot. Define
+// IMPLOT_PARALLEL_FOR before including ImPlot to use a job system; by default jobs run on the calling thread.
+#ifndef IMPLOT_PARALLEL_FOR
+#define IMPLOT_PARALLEL_FOR(count, func) do { for (int _job = 0; _job < (count); ++_job) { (func)(_job); } } while (0)
+#endif
+
 // Split ImU32 color into RGB components [0 255]
 #define IM_COL32_SPLIT_RGB(col,r,g,b) \
     ImU32 r = ((col >> IM_COL32_R_SHIFT) & 0xFF); \
@@ -151,6 +157,56 @@ static inline void ImMinMaxArray(const T* values, int count, T* min_out, T* max_
     }
     *min_out = Min; *max_out = Max;
 }
+#ifdef IMGUI_ENABLE_SSE
+// Finds the min and max value in an unsorted array of floats, skipping NaNs (vectorized)
+static inline void ImMinMaxArray(const float* values, int count, float* min_out, float* max_out) {
+    __m128 vmin0 = _mm_set1_ps(HUGE_VALF), vmin1 = vmin0;
+    __m128 vmax0 = _mm_set1_ps(-HUGE_VALF), vmax1 = vmax0;
+    int i = 0;
+    // operands order makes min/max return the second operand for NaNs, so they are skipped
+    for (; i + 8 <= count; i += 8) {
+        const __m128 v0 = _mm_loadu_ps(values + i);
+        const __m128 v1 = _mm_loadu_ps(values + i + 4);
+        vmin0 = _mm_min_ps(v0, vmin0); vmax0 = _mm_max_ps(v0, vmax0);
+        vmin1 = _mm_min_ps(v1, vmin1); vmax1 = _mm_max_ps(v1, vmax1);
+    }
+    float mins[4], maxs[4];
+    _mm_storeu_ps(mins, _mm_min_ps(vmin0, vmin1));
+    _mm_storeu_ps(maxs, _mm_max_ps(vmax0, vmax1));
+    float Min = ImMin(ImMin(mins[0], mins[1]), ImMin(mins[2], mins[3]));
+    float Max = ImMax(ImMax(maxs[0], maxs[1]), ImMax(maxs[2], maxs[3]));
+    for (; i < count; ++i) {
+        if (values[i] < Min) { Min = values[i]; }
+        if (values[i] > Max) { Max = values[i]; }
+    }
+    // only NaNs
+    if (Min > Max) { ImMinMaxArray<float>(values, count, &Min, &Max); }
+    *min_out = Min; *max_out = Max;
+}
+// Finds the min and max value in an unsorted array of doubles, skipping NaNs (vectorized)
+static inline void ImMinMaxArray(const double* values, int count, double* min_out, double* max_out) {
+    __m128d vmin0 = _mm_set1_pd(HUGE_VAL), vmin1 = vmin0;
+    __m128d vmax0 = _mm_set1_pd(-HUGE_VAL), vmax1 = vmax0;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128d v0 = _mm_loadu_pd(values + i);
+        const __m128d v1 = _mm_loadu_pd(values + i + 2);
+        vmin0 = _mm_min_pd(v0, vmin0); vmax0 = _mm_max_pd(v0, vmax0);
+        vmin1 = _mm_min_pd(v1, vmin1); vmax1 = _mm_max_pd(v1, vmax1);
+    }
+    double mins[2], maxs[2];
+    _mm_storeu_pd(mins, _mm_min_pd(vmin0, vmin1));
+    _mm_storeu_pd(maxs, _mm_max_pd(vmax0, vmax1));
+    double Min = ImMin(mins[0], mins[1]);
+    double Max = ImMax(maxs[0], maxs[1]);
+    for (; i < count; ++i) {
+        if (values[i] < Min) { Min = values[i]; }
+        if (values[i] > Max) { Max = values[i]; }
+    }
+    if (Min > Max) { ImMinMaxArray<double>(values, count, &Min, &Max); }
+    *min_out = Min; *max_out = Max;
+}
+#endif
 // Finds the sim of an array
 template <typename T>
 static inline T ImSum(const T* values, int count) {
@@ -948,9 +1004,15 @@ struct ImPlotItem
     bool         Show;
     bool         LegendHovered;
     bool         SeenThisFrame;
+    ImU64        FitVersion;  // data version of cached fit extents (see SetNextDataVersion)
+    int          FitCount;
+    ImPlotRange  FitExtentsX;
+    ImPlotRange  FitExtentsY;
 
     ImPlotItem() {
         ID            = 0;
+        FitVersion    = 0;
+        FitCount      = 0;
         Color         = IM_COL32_WHITE;
         NameOffset    = -1;
         Show          = true;
@@ -1192,6 +1254,7 @@ struct ImPlotNextItemData {
     bool            HasHidden;
     bool            Hidden;
     ImPlotCond      HiddenCond;
+    ImU64           DataVersion;
     ImPlotNextItemData() { Reset(); }
     void Reset() {
         for (int i = 0; i < 5; ++i)
@@ -1199,9 +1262,45 @@ struct ImPlotNextItemData {
         LineWeight    = MarkerSize = MarkerWeight = FillAlpha = ErrorBarSize = ErrorBarWeight = DigitalBitHeight = DigitalBitGap = IMPLOT_AUTO;
         Marker        = IMPLOT_AUTO;
         HasHidden     = Hidden = false;
+        DataVersion   = 0;
     }
 };
 
+// Histogram bins cached between frames for data with a version (see SetNextDataVersion)
+struct ImPlotHistogramCache {
+    // key
+    const void*          Xs;
+    const void*          Ys;
+    int                  Count;
+    ImU64                Version;
+    int                  XBins, YBins;
+    ImPlotRect           Range;
+    ImPlotHistogramFlags Flags;
+    // results
+    int                  XBinsOut, YBinsOut;
+    ImPlotRect           RangeOut;
+    double               Width, Height;
+    double               MaxCount;
+    ImVector<double>     Centers;
+    ImVector<double>     Counts;
+    int                  LastFrame;
+
+    ImPlotHistogramCache() { Xs = Ys = nullptr; Count = XBins = YBins = XBinsOut = YBinsOut = LastFrame = 0; Version = 0; Flags = 0; Width = Height = MaxCount = 0; }
+};
+
+// Texture with colormapped heatmap values, cached between frames (see ImPlotHeatmapFlags_Texture)
+struct ImPlotHeatmapTexture {
+    ImGuiID        ID;
+    ImTextureID    Texture;
+    const void*    Values;
+    int            Rows, Cols;
+    double         ScaleMin, ScaleMax;
+    ImPlotColormap Colormap;
+    ImU64          Version;
+    bool           ColMajor;
+    int            LastFrame;
+};
+
 // Holds state information that must persist between calls to BeginPlot()/EndPlot()
 struct ImPlotContext {
     // Plot States
@@ -1233,6 +1332,15 @@ struct ImPlotContext {
     // Temp data for general use
     ImVector<double>   TempDouble1, TempDouble2;
     ImVector<int>      TempInt1;
+    ImVector<int>      DecimationIndices;
+
+    // Textures
+    ImVector<ImPlotHeatmapTexture> HeatmapTextures;
+    ImVector<ImU32>                TexturePixels;
+
+    // Histograms
+    ImPool<ImPlotHistogramCache>   HistogramCaches;
+    ImVector<int>                  HistogramPartialCounts;
 
     // Misc
     int                DigitalPlotItemCnt;
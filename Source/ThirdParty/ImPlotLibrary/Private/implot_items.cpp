@@ -352,6 +352,11 @@ void SetNextErrorBarStyle(const ImVec4& col, float size, float weight) {
     gp.NextItemData.ErrorBarWeight             = weight;
 }
 
+void SetNextDataVersion(ImU64 version) {
+    ImPlotContext& gp = *GImPlot;
+    gp.NextItemData.DataVersion = version;
+}
+
 ImVec4 GetLastItemColor() {
     ImPlotContext& gp = *GImPlot;
     if (gp.PreviousItem)
@@ -623,6 +628,18 @@ struct GetterLoop {
     const int Count;
 };
 
+/// Reads a subset of points of another getter (e.g. a decimated series)
+template <typename _Getter>
+struct GetterIndexed {
+    GetterIndexed(_Getter getter, const int* indices, int count) : Getter(getter), Indices(indices), Count(count) { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return Getter(Indices[idx]);
+    }
+    const _Getter Getter;
+    const int* const Indices;
+    const int Count;
+};
+
 template <typename T>
 struct GetterError {
     GetterError(const T* xs, const T* ys, const T* neg, const T* pos, int count, int offset, int stride) :
@@ -653,10 +670,124 @@ struct GetterError {
 // [SECTION] Fitters
 //-----------------------------------------------------------------------------
 
+IMPLOT_INLINE void ExtendExtents(ImPlotRange& extents, double min, double max) {
+    extents.Min = ImMin(extents.Min, min);
+    extents.Max = ImMax(extents.Max, max);
+}
+
+/// Extends extents with the values of an indexer without calling it for each point. Returns false if the indexer has
+/// no fast path, or its values include infinities or only NaNs, which need to be skipped point by point.
+template <typename _Indexer>
+IMPLOT_INLINE bool ExtendIndexerExtents(const _Indexer&, int, ImPlotRange&) {
+    return false;
+}
+
+template <typename T>
+IMPLOT_INLINE bool ExtendIndexerExtents(const IndexerIdx<T>& indexer, int count, ImPlotRange& extents) {
+    // offset only rotates contiguous data, which doesn't change its extents
+    if (indexer.Stride != sizeof(T) || count > indexer.Count)
+        return false;
+    T min, max;
+    ImMinMaxArray(indexer.Data, count, &min, &max);
+    if (ImNanOrInf((double)min) || ImNanOrInf((double)max))
+        return false;
+    ExtendExtents(extents, (double)min, (double)max);
+    return true;
+}
+
+IMPLOT_INLINE bool ExtendIndexerExtents(const IndexerLin& indexer, int count, ImPlotRange& extents) {
+    const double first = indexer(0), last = indexer(count - 1);
+    if (ImNanOrInf(first) || ImNanOrInf(last))
+        return false;
+    ExtendExtents(extents, ImMin(first, last), ImMax(first, last));
+    return true;
+}
+
+IMPLOT_INLINE bool ExtendIndexerExtents(const IndexerConst& indexer, int, ImPlotRange& extents) {
+    if (ImNanOrInf(indexer.Ref))
+        return false;
+    ExtendExtents(extents, indexer.Ref, indexer.Ref);
+    return true;
+}
+
+/// Extends extents with finite coordinates of each point of a getter.
+template <typename _Getter>
+void ScanGetterExtents(const _Getter& getter, ImPlotRange& x_ext, ImPlotRange& y_ext) {
+    for (int i = 0; i < getter.Count; ++i) {
+        const ImPlotPoint p = getter(i);
+        if (!ImNanOrInf(p.x))
+            ExtendExtents(x_ext, p.x, p.x);
+        if (!ImNanOrInf(p.y))
+            ExtendExtents(y_ext, p.y, p.y);
+    }
+}
+
+/// Extends extents with the points of a getter, using fast paths where possible. Returns false if the getter has no
+/// fast path and scanning is not allowed.
+template <typename _Getter>
+IMPLOT_INLINE bool ExtendGetterExtents(const _Getter& getter, ImPlotRange& x_ext, ImPlotRange& y_ext, bool scan) {
+    if (scan)
+        ScanGetterExtents(getter, x_ext, y_ext);
+    return scan;
+}
+
+template <typename _IndexerX, typename _IndexerY>
+IMPLOT_INLINE bool ExtendGetterExtents(const GetterXY<_IndexerX,_IndexerY>& getter, ImPlotRange& x_ext, ImPlotRange& y_ext, bool scan) {
+    ImPlotRange x_fast = x_ext, y_fast = y_ext;
+    if (getter.Count <= 0 || (ExtendIndexerExtents(getter.IndxerX, getter.Count, x_fast) && ExtendIndexerExtents(getter.IndxerY, getter.Count, y_fast))) {
+        x_ext = x_fast;
+        y_ext = y_fast;
+        return true;
+    }
+    if (scan)
+        ScanGetterExtents(getter, x_ext, y_ext);
+    return scan;
+}
+
+/// Extends axis fit with extents of finite values. Returns false if the extents fall outside of axis constraints, in
+/// which case points need to be fitted one by one.
+IMPLOT_INLINE bool ExtendFitWithExtents(ImPlotAxis* axis, const ImPlotRange& extents) {
+    if (axis == nullptr || extents.Min > extents.Max)
+        return true;
+    if (extents.Min < axis->ConstraintRange.Min || extents.Max > axis->ConstraintRange.Max)
+        return false;
+    axis->ExtendFit(extents.Min);
+    axis->ExtendFit(extents.Max);
+    return true;
+}
+
+/// Fits axes (if not null) to the points of one or two getters without fitting them one by one. Contiguous data is
+/// reduced with ImMinMaxArray and extents of data with a version (see SetNextDataVersion) are cached in the current
+/// item, so static data isn't scanned each frame. Fitting must not depend on the other axis (ImPlotAxisFlags_RangeFit).
+/// Returns false if points need to be fitted one by one.
+template <typename _Getter1, typename _Getter2>
+bool FitExtents(const _Getter1& getter1, const _Getter2* getter2, ImPlotAxis* x_axis, ImPlotAxis* y_axis) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotItem* item = gp.CurrentItem;
+    const ImU64 version = gp.NextItemData.DataVersion;
+    const int count = getter1.Count + (getter2 != nullptr ? getter2->Count : 0);
+    if (version == 0 || item == nullptr || item->FitVersion != version || item->FitCount != count) {
+        // data without a version is only reduced if it has a fast path, scanning it would be slower than fitting
+        const bool scan = version != 0 && item != nullptr;
+        ImPlotRange x_ext(HUGE_VAL, -HUGE_VAL), y_ext(HUGE_VAL, -HUGE_VAL);
+        if (!ExtendGetterExtents(getter1, x_ext, y_ext, scan) || (getter2 != nullptr && !ExtendGetterExtents(*getter2, x_ext, y_ext, scan)))
+            return false;
+        if (!scan)
+            return ExtendFitWithExtents(x_axis, x_ext) && ExtendFitWithExtents(y_axis, y_ext);
+        item->FitVersion   = version;
+        item->FitCount     = count;
+        item->FitExtentsX  = x_ext;
+        item->FitExtentsY  = y_ext;
+    }
+    return ExtendFitWithExtents(x_axis, item->FitExtentsX) && ExtendFitWithExtents(y_axis, item->FitExtentsY);
+}
+
 template <typename _Getter1>
 struct Fitter1 {
     Fitter1(const _Getter1& getter) : Getter(getter) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        if (!ImHasFlag(x_axis.Flags | y_axis.Flags, ImPlotAxisFlags_RangeFit) && FitExtents(Getter, static_cast<const _Getter1*>(nullptr), &x_axis, &y_axis))
+            return;
         for (int i = 0; i < Getter.Count; ++i) {
             ImPlotPoint p = Getter(i);
             x_axis.ExtendFitWith(y_axis, p.x, p.y);
@@ -670,6 +801,8 @@ template <typename _Getter1>
 struct FitterX {
     FitterX(const _Getter1& getter) : Getter(getter) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis&) const {
+        if (FitExtents(Getter, static_cast<const _Getter1*>(nullptr), &x_axis, nullptr))
+            return;
         for (int i = 0; i < Getter.Count; ++i) {
             ImPlotPoint p = Getter(i);
             x_axis.ExtendFit(p.x);
@@ -682,6 +815,8 @@ template <typename _Getter1>
 struct FitterY {
     FitterY(const _Getter1& getter) : Getter(getter) { }
     void Fit(ImPlotAxis&, ImPlotAxis& y_axis) const {
+        if (FitExtents(Getter, static_cast<const _Getter1*>(nullptr), nullptr, &y_axis))
+            return;
         for (int i = 0; i < Getter.Count; ++i) {
             ImPlotPoint p = Getter(i);
             y_axis.ExtendFit(p.y);
@@ -694,6 +829,8 @@ template <typename _Getter1, typename _Getter2>
 struct Fitter2 {
     Fitter2(const _Getter1& getter1, const _Getter2& getter2) : Getter1(getter1), Getter2(getter2) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        if (!ImHasFlag(x_axis.Flags | y_axis.Flags, ImPlotAxisFlags_RangeFit) && FitExtents(Getter1, &Getter2, &x_axis, &y_axis))
+            return;
         for (int i = 0; i < Getter1.Count; ++i) {
             ImPlotPoint p = Getter1(i);
             x_axis.ExtendFitWith(y_axis, p.x, p.y);
@@ -849,6 +986,174 @@ struct Transformer2 {
     Transformer1 Ty;
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Decimation
+//-----------------------------------------------------------------------------
+
+// Series with many more points than pixel columns are reduced before primitive generation, so the number of
+// generated vertices is bounded by the plot width rather than by the data size.
+
+// Series with more points per pixel column than this are decimated.
+static const int DECIMATION_MIN_POINTS_PER_COLUMN = 4;
+
+// Number of points per pixel column kept by LTTB.
+static const int DECIMATION_LTTB_POINTS_PER_COLUMN = 2;
+
+IMPLOT_INLINE int GetDecimationColumns() {
+    return (int)ImMax(1.0f, GImPlot->CurrentPlot->PlotRect.GetWidth());
+}
+
+IMPLOT_INLINE bool ShouldDecimate(int count) {
+    return count > DECIMATION_MIN_POINTS_PER_COLUMN * GetDecimationColumns();
+}
+
+/// Min/max state of a single pixel column. Keeps the first and last point and the extremes of up to two series
+/// sharing x values. Points are emitted in their original order, so a line strip through them covers the same
+/// pixels as a line strip through all points in the column.
+struct DecimationColumn {
+    void Begin(int column, int idx, double y1, double y2) {
+        Column = column;
+        First = Last = Min1 = Max1 = Min2 = Max2 = idx;
+        MinY1 = MaxY1 = y1;
+        MinY2 = MaxY2 = y2;
+    }
+    IMPLOT_INLINE void Add(int idx, double y1, double y2) {
+        Last = idx;
+        if (y1 < MinY1) { MinY1 = y1; Min1 = idx; }
+        if (y1 > MaxY1) { MaxY1 = y1; Max1 = idx; }
+        if (y2 < MinY2) { MinY2 = y2; Min2 = idx; }
+        if (y2 > MaxY2) { MaxY2 = y2; Max2 = idx; }
+    }
+    void Flush(ImVector<int>& out) const {
+        int idx[6] = { First, Min1, Max1, Min2, Max2, Last };
+        // insertion sort of a handful of indices
+        for (int i = 1; i < 6; ++i) {
+            for (int j = i; j > 0 && idx[j-1] > idx[j]; --j)
+                ImSwap(idx[j-1], idx[j]);
+        }
+        for (int i = 0; i < 6; ++i) {
+            if (i == 0 || idx[i] != idx[i-1])
+                out.push_back(idx[i]);
+        }
+    }
+    int    Column;
+    int    First, Last;
+    int    Min1, Max1, Min2, Max2;
+    double MinY1, MaxY1, MinY2, MaxY2;
+};
+
+/// Reduces a series (or two series sharing x values, if getter2 is not null) to the min/max/first/last point of
+/// each pixel column. Fails and leaves the series to be rendered in full, if points are not monotonic in pixel
+/// columns, if getters don't share x values or if there are NaNs.
+template <typename _Getter1, typename _Getter2>
+bool DecimateMinMax(const _Getter1& getter1, const _Getter2* getter2, ImVector<int>& out) {
+    const ImPlotPlot& plot = *GImPlot->CurrentPlot;
+    const Transformer1 tx = Transformer2(plot).Tx;
+    // everything beyond the plot edges is gathered in one column on each side; lines through those are not visible
+    const float col_min = ImFloor(plot.PlotRect.Min.x) - 1;
+    const float col_max = ImFloor(plot.PlotRect.Max.x) + 1;
+    const int count = getter1.Count;
+    out.resize(0);
+    DecimationColumn col = DecimationColumn();
+    int dir = 0;
+    for (int i = 0; i < count; ++i) {
+        const ImPlotPoint p1 = getter1(i);
+        double y2 = 0;
+        if (getter2 != nullptr) {
+            const ImPlotPoint p2 = (*getter2)(i);
+            if (p2.x != p1.x)
+                return false;
+            y2 = p2.y;
+        }
+        const float px = tx(p1.x);
+        if (ImNan(px) || ImNan(p1.y) || ImNan(y2))
+            return false;
+        const int c = (int)ImClamp(ImFloor(px), col_min, col_max);
+        if (i == 0) {
+            col.Begin(c, i, p1.y, y2);
+        }
+        else if (c != col.Column) {
+            const int d = c > col.Column ? 1 : -1;
+            if (dir == 0)
+                dir = d;
+            else if (d != dir)
+                return false;
+            col.Flush(out);
+            col.Begin(c, i, p1.y, y2);
+        }
+        else {
+            col.Add(i, p1.y, y2);
+        }
+    }
+    col.Flush(out);
+    return true;
+}
+
+/// Reduces a series with Largest-Triangle-Three-Buckets. Keeps the first and last point and one point per bucket,
+/// the one forming the largest triangle with the previously kept point and the average of the next bucket. Areas
+/// are computed in pixel space, so non-linear axes are handled. Interior points are split into at most count - 2
+/// buckets with integer edges, so every bucket has at least one point; empty buckets are skipped regardless.
+template <typename _Getter>
+void DecimateLTTB(const _Getter& getter, int buckets, ImVector<int>& out) {
+    const Transformer2 transformer;
+    const int count = getter.Count;
+    out.resize(0);
+    if (count <= 0)
+        return;
+    buckets = ImMax(0, ImMin(buckets, count - 2));
+    // first point of bucket b; bucket b spans [edge(b), edge(b + 1)) and edge(buckets) == count - 1
+    auto edge = [count, buckets](int b) { return 1 + (int)((long long)b * (count - 2) / buckets); };
+    out.reserve(buckets + 2);
+    out.push_back(0);
+    ImVec2 pa = transformer(getter(0));
+    for (int b = 0; b < buckets; ++b) {
+        const int start      = edge(b);
+        const int end        = edge(b + 1);
+        if (start >= end)
+            continue;
+        const int next_start = end;
+        const int next_end   = b + 1 < buckets ? edge(b + 2) : count;
+        double avg_x = 0, avg_y = 0;
+        for (int i = next_start; i < next_end; ++i) {
+            const ImVec2 p = transformer(getter(i));
+            avg_x += p.x;
+            avg_y += p.y;
+        }
+        const double inv_n = 1.0 / ImMax(1, next_end - next_start);
+        avg_x *= inv_n;
+        avg_y *= inv_n;
+        int best = start;
+        double best_area = -1;
+        ImVec2 best_p = pa;
+        for (int i = start; i < end; ++i) {
+            const ImVec2 p = transformer(getter(i));
+            // twice the triangle area, which is fine for comparison
+            const double area = ImAbs((pa.x - avg_x) * (p.y - pa.y) - (pa.x - p.x) * (avg_y - pa.y));
+            if (area > best_area) {
+                best_area = area;
+                best = i;
+                best_p = p;
+            }
+        }
+        out.push_back(best);
+        pa = best_p;
+    }
+    if (count > 1)
+        out.push_back(count - 1);
+}
+
+/// Decimates a line series according to flags. Returns false if the series should be rendered in full.
+template <typename _Getter>
+bool DecimateLine(const _Getter& getter, ImPlotLineFlags flags, ImVector<int>& out) {
+    if ((flags & (ImPlotLineFlags_NoDecimation | ImPlotLineFlags_Segments | ImPlotLineFlags_Loop)) != 0 || !ShouldDecimate(getter.Count))
+        return false;
+    if (ImHasFlag(flags, ImPlotLineFlags_DecimateLTTB)) {
+        DecimateLTTB(getter, DECIMATION_LTTB_POINTS_PER_COLUMN * GetDecimationColumns(), out);
+        return true;
+    }
+    return DecimateMinMax(getter, static_cast<const _Getter*>(nullptr), out);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Renderers
 //-----------------------------------------------------------------------------
@@ -1571,6 +1876,33 @@ void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool
 // [SECTION] PlotLine
 //-----------------------------------------------------------------------------
 
+template <typename _Getter>
+void RenderLineSeries(const _Getter& getter, ImPlotLineFlags flags, const ImPlotNextItemData& s) {
+    if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+        GetterOverrideY<_Getter> getter2(getter, 0);
+        RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
+    }
+    if (s.RenderLine) {
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+        if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
+            RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
+        }
+        else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
+            if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+            else
+                RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+        }
+        else {
+            if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
+            else
+                RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
+        }
+    }
+}
+
 template <typename _Getter>
 void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
     if (BeginItemEx(label_id, Fitter1<_Getter>(getter), flags, ImPlotCol_Line)) {
@@ -1579,30 +1911,12 @@ void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags fla
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
-        if (getter.Count > 1) {
-            if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
-                const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-                GetterOverrideY<_Getter> getter2(getter, 0);
-                RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
-            }
-            if (s.RenderLine) {
-                const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-                if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
-                    RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
-                }
-                else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                }
-                else {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
-                }
-            }
+        if (getter.Count > 1 && (s.RenderLine || (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill))) {
+            ImVector<int>& indices = GImPlot->DecimationIndices;
+            if (DecimateLine(getter, flags, indices))
+                RenderLineSeries(GetterIndexed<_Getter>(getter, indices.Data, indices.Size), flags, s);
+            else
+                RenderLineSeries(getter, flags, s);
         }
         // render markers
         if (s.Marker != ImPlotMarker_None) {
@@ -1770,7 +2084,11 @@ void PlotShadedEx(const char* label_id, const Getter1& getter1, const Getter2& g
         const ImPlotNextItemData& s = GetItemData();
         if (s.RenderFill) {
             const ImU32 col = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-            RenderPrimitives2<RendererShaded>(getter1,getter2,col);
+            ImVector<int>& indices = GImPlot->DecimationIndices;
+            if (!ImHasFlag(flags, ImPlotShadedFlags_NoDecimation) && getter1.Count == getter2.Count && ShouldDecimate(getter1.Count) && DecimateMinMax(getter1, &getter2, indices))
+                RenderPrimitives2<RendererShaded>(GetterIndexed<Getter1>(getter1, indices.Data, indices.Size), GetterIndexed<Getter2>(getter2, indices.Data, indices.Size), col);
+            else
+                RenderPrimitives2<RendererShaded>(getter1,getter2,col);
         }
         EndItem();
     }
@@ -2414,33 +2732,10 @@ struct GetterHeatmapColMaj {
 };
 
 template <typename T>
-void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
-    ImPlotContext& gp = *GImPlot;
+void RenderHeatmapLabels(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
     Transformer2 transformer;
-    if (scale_min == 0 && scale_max == 0) {
-        T temp_min, temp_max;
-        ImMinMaxArray(values,rows*cols,&temp_min,&temp_max);
-        scale_min = (double)temp_min;
-        scale_max = (double)temp_max;
-    }
-    if (scale_min == scale_max) {
-        ImVec2 a = transformer(bounds_min);
-        ImVec2 b = transformer(bounds_max);
-        ImU32  col = GetColormapColorU32(0,gp.Style.Colormap);
-        draw_list.AddRectFilled(a, b, col);
-        return;
-    }
     const double yref = reverse_y ? bounds_max.y : bounds_min.y;
     const double ydir = reverse_y ? -1 : 1;
-    if (col_maj) {
-        GetterHeatmapColMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
-    }
-    else {
-        GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
-    }
-    // labels
     if (fmt != nullptr) {
         const double w = (bounds_max.x - bounds_min.x) / cols;
         const double h = (bounds_max.y - bounds_min.y) / rows;
@@ -2485,6 +2780,121 @@ void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, d
     }
 }
 
+template <typename T>
+void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
+    ImPlotContext& gp = *GImPlot;
+    Transformer2 transformer;
+    if (scale_min == 0 && scale_max == 0) {
+        T temp_min, temp_max;
+        ImMinMaxArray(values,rows*cols,&temp_min,&temp_max);
+        scale_min = (double)temp_min;
+        scale_max = (double)temp_max;
+    }
+    if (scale_min == scale_max) {
+        ImVec2 a = transformer(bounds_min);
+        ImVec2 b = transformer(bounds_max);
+        ImU32  col = GetColormapColorU32(0,gp.Style.Colormap);
+        draw_list.AddRectFilled(a, b, col);
+        return;
+    }
+    const double yref = reverse_y ? bounds_max.y : bounds_min.y;
+    const double ydir = reverse_y ? -1 : 1;
+    if (col_maj) {
+        GetterHeatmapColMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
+        RenderPrimitives1<RendererRectC>(getter);
+    }
+    else {
+        GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
+        RenderPrimitives1<RendererRectC>(getter);
+    }
+    RenderHeatmapLabels(draw_list, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, reverse_y, col_maj);
+}
+
+/// Frames after which textures of heatmaps that are no longer plotted are released
+static const int HEATMAP_TEXTURE_MAX_UNUSED_FRAMES = 60;
+
+/// Colormaps values into a texture and draws it as a single image. The texture is cached per item and only updated
+/// when values, their layout, scale, colormap or data version change. Returns false if textures are not supported.
+template <typename T>
+bool RenderHeatmapTexture(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool col_maj) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotTextureUpdateFunc update_func;
+    ImPlotTextureReleaseFunc release_func;
+    void* user_data;
+    GetTextureFunctions(&update_func, &release_func, &user_data);
+    if (update_func == nullptr)
+        return false;
+
+    // release textures of heatmaps that are no longer plotted
+    const int frame = ImGui::GetFrameCount();
+    for (int i = gp.HeatmapTextures.Size - 1; i >= 0; --i) {
+        if (frame - gp.HeatmapTextures[i].LastFrame > HEATMAP_TEXTURE_MAX_UNUSED_FRAMES) {
+            if (release_func != nullptr && gp.HeatmapTextures[i].Texture != 0)
+                release_func(gp.HeatmapTextures[i].Texture, user_data);
+            gp.HeatmapTextures.erase_unsorted(gp.HeatmapTextures.Data + i);
+        }
+    }
+
+    const ImGuiID id = GetCurrentItem()->ID;
+    ImPlotHeatmapTexture* entry = nullptr;
+    for (int i = 0; i < gp.HeatmapTextures.Size && entry == nullptr; ++i) {
+        if (gp.HeatmapTextures[i].ID == id)
+            entry = &gp.HeatmapTextures[i];
+    }
+    if (entry == nullptr) {
+        gp.HeatmapTextures.push_back(ImPlotHeatmapTexture());
+        entry = &gp.HeatmapTextures.back();
+        entry->ID = id;
+    }
+    entry->LastFrame = frame;
+
+    // requested scale is a part of the key, so automatic scale doesn't need to be recomputed for cached textures
+    const ImU64 version = gp.NextItemData.DataVersion;
+    const bool changed = version == 0 || entry->Version != version || entry->Values != values || entry->Rows != rows || entry->Cols != cols
+        || entry->ScaleMin != scale_min || entry->ScaleMax != scale_max || entry->Colormap != gp.Style.Colormap || entry->ColMajor != col_maj;
+    const double requested_min = scale_min;
+    const double requested_max = scale_max;
+    if (scale_min == 0 && scale_max == 0 && (changed || fmt != nullptr)) {
+        T temp_min, temp_max;
+        ImMinMaxArray(values,rows*cols,&temp_min,&temp_max);
+        scale_min = (double)temp_min;
+        scale_max = (double)temp_max;
+    }
+    if (changed) {
+        // pixels are always stored in row major order, with the first row on top
+        gp.TexturePixels.resize(rows*cols);
+        ImU32* pixels = gp.TexturePixels.Data;
+        const ImPlotColormap cmap = gp.Style.Colormap;
+        const double inv_range = scale_min != scale_max ? 1.0 / (scale_max - scale_min) : 0.0;
+        for (int r = 0; r < rows; ++r) {
+            for (int c = 0; c < cols; ++c) {
+                const double val = (double)values[col_maj ? r + c * rows : r * cols + c];
+                const float t = ImClamp((float)((val - scale_min) * inv_range), 0.0f, 1.0f);
+                pixels[r * cols + c] = gp.ColormapData.LerpTable(cmap, t);
+            }
+        }
+        const ImTextureID texture = update_func(entry->Texture, pixels, cols, rows, user_data);
+        if (texture == 0) {
+            entry->Version = 0;
+            return false;
+        }
+        entry->Texture  = texture;
+        entry->Values   = values;
+        entry->Rows     = rows;
+        entry->Cols     = cols;
+        entry->ScaleMin = requested_min;
+        entry->ScaleMax = requested_max;
+        entry->Colormap = cmap;
+        entry->ColMajor = col_maj;
+        entry->Version  = version;
+    }
+
+    Transformer2 transformer;
+    draw_list.AddImage(entry->Texture, transformer(bounds_min.x, bounds_max.y), transformer(bounds_max.x, bounds_min.y));
+    RenderHeatmapLabels(draw_list, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, true, col_maj);
+    return true;
+}
+
 template <typename T>
 void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, ImPlotHeatmapFlags flags) {
     if (BeginItemEx(label_id, FitterRect(bounds_min, bounds_max))) {
@@ -2494,7 +2904,8 @@ void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, doub
         }
         ImDrawList& draw_list = *GetPlotDrawList();
         const bool col_maj = ImHasFlag(flags, ImPlotHeatmapFlags_ColMajor);
-        RenderHeatmap(draw_list, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, true, col_maj);
+        if (!ImHasFlag(flags, ImPlotHeatmapFlags_Texture) || !RenderHeatmapTexture(draw_list, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, col_maj))
+            RenderHeatmap(draw_list, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, true, col_maj);
         EndItem();
     }
 }
@@ -2506,16 +2917,133 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotHistogram
 //-----------------------------------------------------------------------------
 
+// Values binned by a single job. Smaller inputs are binned on the calling thread.
+static const int HISTOGRAM_VALUES_PER_JOB = 256 * 1024;
+// Max number of jobs binning a single histogram.
+static const int HISTOGRAM_MAX_JOBS = 16;
+// Max number of partial bin counts of all jobs (limits memory used by histograms with many bins).
+static const int HISTOGRAM_MAX_PARTIAL_COUNTS = 4 * 1024 * 1024;
+// Frames after which cached histograms that are no longer plotted are released.
+static const int HISTOGRAM_CACHE_MAX_UNUSED_FRAMES = 60;
+
+IMPLOT_INLINE int GetHistogramJobs(int count, int bins) {
+    int jobs = ImClamp(count / HISTOGRAM_VALUES_PER_JOB, 1, HISTOGRAM_MAX_JOBS);
+    while (jobs > 1 && jobs > HISTOGRAM_MAX_PARTIAL_COUNTS / bins)
+        --jobs;
+    return jobs;
+}
+
+/// Returns the histogram cache of the next item, if its data has a version (see SetNextDataVersion). Cached results
+/// are valid if valid_out is true, otherwise the cache is keyed with the new arguments and results must be stored.
+static ImPlotHistogramCache* GetHistogramCache(const char* label_id, const void* xs, const void* ys, int count, int x_bins, int y_bins, const ImPlotRect& range, ImPlotHistogramFlags flags, bool* valid_out) {
+    ImPlotContext& gp = *GImPlot;
+    *valid_out = false;
+    const ImU64 version = gp.NextItemData.DataVersion;
+    if (version == 0 || gp.CurrentPlot == nullptr)
+        return nullptr;
+    // release histograms that are no longer plotted
+    const int frame = ImGui::GetFrameCount();
+    for (int n = 0; n < gp.HistogramCaches.GetMapSize(); ++n) {
+        ImPlotHistogramCache* entry = gp.HistogramCaches.TryGetMapData(n);
+        if (entry != nullptr && frame - entry->LastFrame > HISTOGRAM_CACHE_MAX_UNUSED_FRAMES)
+            gp.HistogramCaches.Remove(gp.HistogramCaches.Map.Data[n].key, entry);
+    }
+    ImPlotHistogramCache* cache = gp.HistogramCaches.GetOrAddByKey(ImHashStr(label_id, 0, gp.CurrentPlot->ID));
+    cache->LastFrame = frame;
+    *valid_out = cache->Version == version && cache->Xs == xs && cache->Ys == ys && cache->Count == count
+        && cache->XBins == x_bins && cache->YBins == y_bins && cache->Flags == flags
+        && cache->Range.X.Min == range.X.Min && cache->Range.X.Max == range.X.Max
+        && cache->Range.Y.Min == range.Y.Min && cache->Range.Y.Max == range.Y.Max;
+    if (!*valid_out) {
+        cache->Version = version;
+        cache->Xs      = xs;
+        cache->Ys      = ys;
+        cache->Count   = count;
+        cache->XBins   = x_bins;
+        cache->YBins   = y_bins;
+        cache->Flags   = flags;
+        cache->Range   = range;
+    }
+    return cache;
+}
+
+IMPLOT_INLINE void BinValue1D(double val, double min, double max, double inv_width, int bins, int* counts, int& below) {
+    if (val >= min && val <= max)
+        counts[ImMin((int)((val - min) * inv_width), bins - 1)]++;
+    else if (val < min)
+        below++;
+}
+
+/// Counts values in [first last) falling into each bin and values below the range.
 template <typename T>
-double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
+void BinValues1D(const T* values, int first, int last, double min, double max, double inv_width, int bins, int* counts, int* below_out) {
+    int below = 0;
+    for (int i = first; i < last; ++i)
+        BinValue1D((double)values[i], min, max, inv_width, bins, counts, below);
+    *below_out = below;
+}
+
+#ifdef IMGUI_ENABLE_SSE
+IMPLOT_INLINE void BinPair1D(__m128d v, __m128d vmin, __m128d vmax, __m128d vinv, int bins, int* counts, int& below) {
+    const int in_range   = _mm_movemask_pd(_mm_and_pd(_mm_cmpge_pd(v, vmin), _mm_cmple_pd(v, vmax)));
+    const int below_mask = _mm_movemask_pd(_mm_cmplt_pd(v, vmin));
+    const __m128i idx    = _mm_cvttpd_epi32(_mm_mul_pd(_mm_sub_pd(v, vmin), vinv));
+    below += (below_mask & 1) + (below_mask >> 1);
+    if (in_range & 1)
+        counts[ImMin(_mm_cvtsi128_si32(idx), bins - 1)]++;
+    if (in_range & 2)
+        counts[ImMin(_mm_cvtsi128_si32(_mm_srli_si128(idx, 4)), bins - 1)]++;
+}
+
+template <>
+void BinValues1D<double>(const double* values, int first, int last, double min, double max, double inv_width, int bins, int* counts, int* below_out) {
+    const __m128d vmin = _mm_set1_pd(min), vmax = _mm_set1_pd(max), vinv = _mm_set1_pd(inv_width);
+    int below = 0;
+    int i = first;
+    for (; i + 2 <= last; i += 2)
+        BinPair1D(_mm_loadu_pd(values + i), vmin, vmax, vinv, bins, counts, below);
+    for (; i < last; ++i)
+        BinValue1D(values[i], min, max, inv_width, bins, counts, below);
+    *below_out = below;
+}
+
+template <>
+void BinValues1D<float>(const float* values, int first, int last, double min, double max, double inv_width, int bins, int* counts, int* below_out) {
+    const __m128d vmin = _mm_set1_pd(min), vmax = _mm_set1_pd(max), vinv = _mm_set1_pd(inv_width);
+    int below = 0;
+    int i = first;
+    for (; i + 4 <= last; i += 4) {
+        const __m128 v = _mm_loadu_ps(values + i);
+        BinPair1D(_mm_cvtps_pd(v), vmin, vmax, vinv, bins, counts, below);
+        BinPair1D(_mm_cvtps_pd(_mm_movehl_ps(v, v)), vmin, vmax, vinv, bins, counts, below);
+    }
+    for (; i < last; ++i)
+        BinValue1D((double)values[i], min, max, inv_width, bins, counts, below);
+    *below_out = below;
+}
+#endif
+
+/// Counts values in [first last) falling into each 2D bin.
+template <typename T>
+void BinValues2D(const T* xs, const T* ys, int first, int last, const ImPlotRect& range, double inv_width, double inv_height, int x_bins, int y_bins, int* counts) {
+    for (int i = first; i < last; ++i) {
+        const double x = (double)xs[i];
+        const double y = (double)ys[i];
+        if (range.Contains(x, y)) {
+            const int xb = ImMin((int)((x - range.X.Min) * inv_width), x_bins - 1);
+            const int yb = ImMin((int)((y - range.Y.Min) * inv_height), y_bins - 1);
+            counts[yb * x_bins + xb]++;
+        }
+    }
+}
+
+template <typename T>
+double CalcHistogram(const T* values, int count, int& bins, ImPlotRange range, ImPlotHistogramFlags flags, ImVector<double>& bin_centers, ImVector<double>& bin_counts, double& width) {
 
     const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative);
     const bool density    = ImHasFlag(flags, ImPlotHistogramFlags_Density);
     const bool outliers   = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
 
-    if (count <= 0 || bins == 0)
-        return 0;
-
     if (range.Min == 0 && range.Max == 0) {
         T Min, Max;
         ImMinMaxArray(values, count, &Min, &Max);
@@ -2523,38 +3051,47 @@ double PlotHistogram(const char* label_id, const T* values, int count, int bins,
         range.Max = (double)Max;
     }
 
-    double width;
     if (bins < 0)
         CalculateBins(values, count, bins, range, bins, width);
     else
         width = range.Size() / bins;
 
-    ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_centers = gp.TempDouble1;
-    ImVector<double>& bin_counts  = gp.TempDouble2;
     bin_centers.resize(bins);
     bin_counts.resize(bins);
-    int below = 0;
 
-    for (int b = 0; b < bins; ++b) {
+    for (int b = 0; b < bins; ++b)
         bin_centers[b] = range.Min + b * width + width * 0.5;
-        bin_counts[b] = 0;
-    }
+
+    // every job counts into its own bins, followed by the count of values below the range
+    ImPlotContext& gp = *GImPlot;
+    const int jobs     = GetHistogramJobs(count, bins);
+    const int job_size = (count + jobs - 1) / jobs;
+    const int stride   = bins + 1;
+    gp.HistogramPartialCounts.resize(jobs * stride);
+    int* partial_counts = gp.HistogramPartialCounts.Data;
+    memset(partial_counts, 0, gp.HistogramPartialCounts.size_in_bytes());
+    const double min = range.Min, max = range.Max, inv_width = 1.0 / width;
+    auto bin_job = [=](int job) {
+        int* counts = partial_counts + job * stride;
+        const int first = job * job_size;
+        BinValues1D(values, first, ImMin(first + job_size, count), min, max, inv_width, bins, counts, &counts[bins]);
+    };
+    IMPLOT_PARALLEL_FOR(jobs, bin_job);
+
+    int below = 0;
     int counted = 0;
     double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        double val = (double)values[i];
-        if (range.Contains(val)) {
-            const int b = ImClamp((int)((val - range.Min) / width), 0, bins - 1);
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
-        }
-        else if (val < range.Min) {
-            below++;
-        }
+    for (int b = 0; b < bins; ++b) {
+        int bin_count = 0;
+        for (int job = 0; job < jobs; ++job)
+            bin_count += partial_counts[job * stride + b];
+        bin_counts[b] = bin_count;
+        counted += bin_count;
+        max_count = ImMax(max_count, (double)bin_count);
     }
+    for (int job = 0; job < jobs; ++job)
+        below += partial_counts[job * stride + bins];
+
     if (cumulative && density) {
         if (outliers)
             bin_counts[0] += below;
@@ -2578,6 +3115,35 @@ double PlotHistogram(const char* label_id, const T* values, int count, int bins,
             bin_counts[b] *= scale;
         max_count *= scale;
     }
+    return max_count;
+}
+
+template <typename T>
+double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
+
+    if (count <= 0 || bins == 0)
+        return 0;
+
+    ImPlotContext& gp = *GImPlot;
+    bool cached;
+    ImPlotHistogramCache* cache = GetHistogramCache(label_id, values, nullptr, count, bins, 0, ImPlotRect(range.Min, range.Max, 0, 0), flags, &cached);
+    ImVector<double>& bin_centers = cache != nullptr ? cache->Centers : gp.TempDouble1;
+    ImVector<double>& bin_counts  = cache != nullptr ? cache->Counts  : gp.TempDouble2;
+    double width, max_count;
+    if (cached) {
+        bins      = cache->XBinsOut;
+        width     = cache->Width;
+        max_count = cache->MaxCount;
+    }
+    else {
+        max_count = CalcHistogram(values, count, bins, range, flags, bin_centers, bin_counts, width);
+        if (cache != nullptr) {
+            cache->XBinsOut = bins;
+            cache->Width    = width;
+            cache->MaxCount = max_count;
+        }
+    }
+
     if (ImHasFlag(flags, ImPlotHistogramFlags_Horizontal))
         PlotBars(label_id, &bin_counts.Data[0], &bin_centers.Data[0], bins, bar_scale*width, ImPlotBarsFlags_Horizontal);
     else
@@ -2593,15 +3159,11 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 //-----------------------------------------------------------------------------
 
 template <typename T>
-double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags) {
+double CalcHistogram2D(const T* xs, const T* ys, int count, int& x_bins, int& y_bins, ImPlotRect& range, ImPlotHistogramFlags flags, ImVector<double>& bin_counts) {
 
     // const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative); NOT SUPPORTED
     const bool density  = ImHasFlag(flags, ImPlotHistogramFlags_Density);
     const bool outliers = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
-    const bool col_maj  = ImHasFlag(flags, ImPlotHistogramFlags_ColMajor);
-
-    if (count <= 0 || x_bins == 0 || y_bins == 0)
-        return 0;
 
     if (range.X.Min == 0 && range.X.Max == 0) {
         T Min, Max;
@@ -2628,25 +3190,33 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
 
     const int bins = x_bins * y_bins;
 
-    ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_counts = gp.TempDouble1;
     bin_counts.resize(bins);
 
-    for (int b = 0; b < bins; ++b)
-        bin_counts[b] = 0;
+    // every job counts into its own bins
+    ImPlotContext& gp = *GImPlot;
+    const int jobs     = GetHistogramJobs(count, bins);
+    const int job_size = (count + jobs - 1) / jobs;
+    gp.HistogramPartialCounts.resize(jobs * bins);
+    int* partial_counts = gp.HistogramPartialCounts.Data;
+    memset(partial_counts, 0, gp.HistogramPartialCounts.size_in_bytes());
+    const ImPlotRect bin_range = range;
+    const double inv_width = 1.0 / width, inv_height = 1.0 / height;
+    const int cols = x_bins, rows = y_bins;
+    auto bin_job = [=](int job) {
+        const int first = job * job_size;
+        BinValues2D(xs, ys, first, ImMin(first + job_size, count), bin_range, inv_width, inv_height, cols, rows, partial_counts + job * bins);
+    };
+    IMPLOT_PARALLEL_FOR(jobs, bin_job);
 
     int counted = 0;
     double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        if (range.Contains((double)xs[i], (double)ys[i])) {
-            const int xb = ImClamp( (int)((double)(xs[i] - range.X.Min) / width)  , 0, x_bins - 1);
-            const int yb = ImClamp( (int)((double)(ys[i] - range.Y.Min) / height) , 0, y_bins - 1);
-            const int b  = yb * x_bins + xb;
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
-        }
+    for (int b = 0; b < bins; ++b) {
+        int bin_count = 0;
+        for (int job = 0; job < jobs; ++job)
+            bin_count += partial_counts[job * bins + b];
+        bin_counts[b] = bin_count;
+        counted += bin_count;
+        max_count = ImMax(max_count, (double)bin_count);
     }
     if (density) {
         double scale = 1.0 / ((outliers ? count : counted) * width * height);
@@ -2654,6 +3224,37 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
             bin_counts[b] *= scale;
         max_count *= scale;
     }
+    return max_count;
+}
+
+template <typename T>
+double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags) {
+
+    const bool col_maj  = ImHasFlag(flags, ImPlotHistogramFlags_ColMajor);
+
+    if (count <= 0 || x_bins == 0 || y_bins == 0)
+        return 0;
+
+    ImPlotContext& gp = *GImPlot;
+    bool cached;
+    ImPlotHistogramCache* cache = GetHistogramCache(label_id, xs, ys, count, x_bins, y_bins, range, flags, &cached);
+    ImVector<double>& bin_counts = cache != nullptr ? cache->Counts : gp.TempDouble1;
+    double max_count;
+    if (cached) {
+        x_bins    = cache->XBinsOut;
+        y_bins    = cache->YBinsOut;
+        range     = cache->RangeOut;
+        max_count = cache->MaxCount;
+    }
+    else {
+        max_count = CalcHistogram2D(xs, ys, count, x_bins, y_bins, range, flags, bin_counts);
+        if (cache != nullptr) {
+            cache->XBinsOut = x_bins;
+            cache->YBinsOut = y_bins;
+            cache->RangeOut = range;
+            cache->MaxCount = max_count;
+        }
+    }
 
     if (BeginItemEx(label_id, FitterRect(range))) {
         if (y_bins <= 0 || x_bins <= 0) {
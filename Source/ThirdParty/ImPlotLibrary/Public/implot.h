@@ -236,6 +236,8 @@ enum ImPlotLineFlags_ {
     ImPlotLineFlags_SkipNaN     = 1 << 12, // NaNs values will be skipped instead of rendered as missing data
     ImPlotLineFlags_NoClip      = 1 << 13, // markers (if displayed) on the edge of a plot will not be clipped
     ImPlotLineFlags_Shaded      = 1 << 14, // a filled region between the line and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotLineFlags_NoDecimation = 1 << 15, // lines with many more points than pixel columns will not be reduced to the min/max/first/last point of each column before rendering
+    ImPlotLineFlags_DecimateLTTB = 1 << 16, // lines with many more points than pixel columns will be reduced with Largest-Triangle-Three-Buckets (fewer vertices, but not pixel exact)
 };
 
 // Flags for PlotScatter
@@ -251,9 +253,10 @@ enum ImPlotStairsFlags_ {
     ImPlotStairsFlags_Shaded   = 1 << 11  // a filled region between the stairs and horizontal origin will be rendered; use PlotShaded for more advanced cases
 };
 
-// Flags for PlotShaded (placeholder)
+// Flags for PlotShaded
 enum ImPlotShadedFlags_ {
-    ImPlotShadedFlags_None  = 0 // default
+    ImPlotShadedFlags_None         = 0,       // default
+    ImPlotShadedFlags_NoDecimation = 1 << 10, // regions with many more points than pixel columns will not be reduced to the min/max/first/last point of each column before rendering
 };
 
 // Flags for PlotBars
@@ -298,6 +301,7 @@ enum ImPlotPieChartFlags_ {
 enum ImPlotHeatmapFlags_ {
     ImPlotHeatmapFlags_None     = 0,       // default
     ImPlotHeatmapFlags_ColMajor = 1 << 10, // data will be read in column major order
+    ImPlotHeatmapFlags_Texture  = 1 << 11, // values will be colormapped into a texture drawn as a single image (requires SetTextureFunctions); the texture is only updated when values, size, scale, colormap or data version (see SetNextDataVersion) change
 };
 
 // Flags for PlotHistogram and PlotHistogram2D
@@ -593,6 +597,13 @@ typedef ImPlotPoint (*ImPlotGetter)(int idx, void* user_data);
 // Callback signature for axis transform.
 typedef double (*ImPlotTransform)(double value, void* user_data);
 
+// Callback signature for creating or updating a texture with RGBA pixels (IM_COL32 layout). texture is the texture
+// returned by a previous call or 0 to create a new one. Returns the texture to use or 0 if it couldn't be created.
+typedef ImTextureID (*ImPlotTextureUpdateFunc)(ImTextureID texture, const ImU32* pixels, int width, int height, void* user_data);
+
+// Callback signature for releasing a texture created with ImPlotTextureUpdateFunc.
+typedef void (*ImPlotTextureReleaseFunc)(ImTextureID texture, void* user_data);
+
 namespace ImPlot {
 
 //-----------------------------------------------------------------------------
@@ -614,6 +625,11 @@ IMPLOT_API void SetCurrentContext(ImPlotContext* ctx);
 // See GImGui documentation in imgui.cpp for more details.
 IMPLOT_API void SetImGuiContext(ImGuiContext* ctx);
 
+// Sets the functions used to create, update and release textures (e.g. for ImPlotHeatmapFlags_Texture). These are
+// shared by all contexts, like ImGui allocator functions. Without them, items fall back to rendering primitives.
+IMPLOT_API void SetTextureFunctions(ImPlotTextureUpdateFunc update_func, ImPlotTextureReleaseFunc release_func, void* user_data = nullptr);
+IMPLOT_API void GetTextureFunctions(ImPlotTextureUpdateFunc* p_update_func, ImPlotTextureReleaseFunc* p_release_func, void** p_user_data);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Begin/End Plot
 //-----------------------------------------------------------------------------
@@ -1125,6 +1141,11 @@ IMPLOT_API void SetNextFillStyle(const ImVec4& col = IMPLOT_AUTO_COL, float alph
 IMPLOT_API void SetNextMarkerStyle(ImPlotMarker marker = IMPLOT_AUTO, float size = IMPLOT_AUTO, const ImVec4& fill = IMPLOT_AUTO_COL, float weight = IMPLOT_AUTO, const ImVec4& outline = IMPLOT_AUTO_COL);
 // Set the error bar style for the next item only.
 IMPLOT_API void SetNextErrorBarStyle(const ImVec4& col = IMPLOT_AUTO_COL, float size = IMPLOT_AUTO, float weight = IMPLOT_AUTO);
+// Set the version of the data passed to the next item only. Items that cache results derived from their data
+// reuse them while the data pointer and version stay the same (axis fit extents are reused while the version and
+// number of points stay the same). Change the version whenever the data changes.
+// Version 0 (default) means that data can change at any time, so nothing is cached.
+IMPLOT_API void SetNextDataVersion(ImU64 version);
 
 // Gets the last item primary color (i.e. its legend icon color)
 IMPLOT_API ImVec4 GetLastItemColor();